@@ -0,0 +1,849 @@
+// generated by mkbundle.py from the web files, do not edit
+// included by lhweb.cpp only
+#ifndef LHBUNDLE_H
+#define LHBUNDLE_H
+
+#define BUNDLE_COUNT 7
+
+// /w3.css, 5268 bytes
+static const uint8_t bundle_w3_css[] PROGMEM={
+    0x2f,0x2a,0x20,0x57,0x33,0x2e,0x43,0x53,0x53,0x20,0x32,0x2e,0x30,0x20,0x62,0x79,
+    0x20,0x4a,0x61,0x6e,0x20,0x45,0x67,0x69,0x6c,0x20,0x61,0x6e,0x64,0x20,0x42,0x6f,
+    0x72,0x67,0x65,0x20,0x52,0x65,0x66,0x73,0x6e,0x65,0x73,0x2e,0x20,0x44,0x6f,0x20,
+    0x6e,0x6f,0x74,0x20,0x72,0x65,0x6d,0x6f,0x76,0x65,0x20,0x74,0x68,0x69,0x73,0x20,
+    0x6c,0x69,0x6e,0x65,0x2e,0x20,0x2a,0x2f,0x0a,0x2a,0x7b,0x2d,0x77,0x65,0x62,0x6b,
+    0x69,0x74,0x2d,0x62,0x6f,0x78,0x2d,0x73,0x69,0x7a,0x69,0x6e,0x67,0x3a,0x62,0x6f,
+    0x72,0x64,0x65,0x72,0x2d,0x62,0x6f,0x78,0x3b,0x2d,0x6d,0x6f,0x7a,0x2d,0x62,0x6f,
+    0x78,0x2d,0x73,0x69,0x7a,0x69,0x6e,0x67,0x3a,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,
+    0x62,0x6f,0x78,0x3b,0x62,0x6f,0x78,0x2d,0x73,0x69,0x7a,0x69,0x6e,0x67,0x3a,0x62,
+    0x6f,0x72,0x64,0x65,0x72,0x2d,0x62,0x6f,0x78,0x7d,0x68,0x74,0x6d,0x6c,0x7b,0x2d,
+    0x6d,0x73,0x2d,0x74,0x65,0x78,0x74,0x2d,0x73,0x69,0x7a,0x65,0x2d,0x61,0x64,0x6a,
+    0x75,0x73,0x74,0x3a,0x31,0x30,0x30,0x25,0x3b,0x2d,0x77,0x65,0x62,0x6b,0x69,0x74,
+    0x2d,0x74,0x65,0x78,0x74,0x2d,0x73,0x69,0x7a,0x65,0x2d,0x61,0x64,0x6a,0x75,0x73,
+    0x74,0x3a,0x31,0x30,0x30,0x25,0x7d,0x62,0x6f,0x64,0x79,0x7b,0x6d,0x61,0x72,0x67,
+    0x69,0x6e,0x3a,0x30,0x7d,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x2c,0x61,0x73,0x69,
+    0x64,0x65,0x2c,0x64,0x65,0x74,0x61,0x69,0x6c,0x73,0x2c,0x66,0x69,0x67,0x63,0x61,
+    0x70,0x74,0x69,0x6f,0x6e,0x2c,0x66,0x69,0x67,0x75,0x72,0x65,0x2c,0x66,0x6f,0x6f,
+    0x74,0x65,0x72,0x2c,0x68,0x65,0x61,0x64,0x65,0x72,0x2c,0x68,0x67,0x72,0x6f,0x75,
+    0x70,0x2c,0x6d,0x61,0x69,0x6e,0x2c,0x6d,0x65,0x6e,0x75,0x2c,0x6e,0x61,0x76,0x2c,
+    0x73,0x65,0x63,0x74,0x69,0x6f,0x6e,0x2c,0x73,0x75,0x6d,0x6d,0x61,0x72,0x79,0x7b,
+    0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x62,0x6c,0x6f,0x63,0x6b,0x7d,0x61,0x75,
+    0x64,0x69,0x6f,0x2c,0x63,0x61,0x6e,0x76,0x61,0x73,0x2c,0x76,0x69,0x64,0x65,0x6f,
+    0x7b,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x2d,
+    0x62,0x6c,0x6f,0x63,0x6b,0x3b,0x76,0x65,0x72,0x74,0x69,0x63,0x61,0x6c,0x2d,0x61,
+    0x6c,0x69,0x67,0x6e,0x3a,0x62,0x61,0x73,0x65,0x6c,0x69,0x6e,0x65,0x7d,0x61,0x75,
+    0x64,0x69,0x6f,0x3a,0x6e,0x6f,0x74,0x28,0x5b,0x63,0x6f,0x6e,0x74,0x72,0x6f,0x6c,
+    0x73,0x5d,0x29,0x7b,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x6e,0x6f,0x6e,0x65,
+    0x3b,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x30,0x7d,0x5b,0x68,0x69,0x64,0x64,0x65,
+    0x6e,0x5d,0x2c,0x74,0x65,0x6d,0x70,0x6c,0x61,0x74,0x65,0x7b,0x64,0x69,0x73,0x70,
+    0x6c,0x61,0x79,0x3a,0x6e,0x6f,0x6e,0x65,0x7d,0x61,0x7b,0x2d,0x77,0x65,0x62,0x6b,
+    0x69,0x74,0x2d,0x74,0x61,0x70,0x2d,0x68,0x69,0x67,0x68,0x6c,0x69,0x67,0x68,0x74,
+    0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x74,0x72,0x61,0x6e,0x73,0x70,0x61,0x72,0x65,
+    0x6e,0x74,0x3b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,
+    0x6c,0x6f,0x72,0x3a,0x74,0x72,0x61,0x6e,0x73,0x70,0x61,0x72,0x65,0x6e,0x74,0x7d,
+    0x61,0x3a,0x61,0x63,0x74,0x69,0x76,0x65,0x2c,0x61,0x3a,0x68,0x6f,0x76,0x65,0x72,
+    0x7b,0x6f,0x75,0x74,0x6c,0x69,0x6e,0x65,0x3a,0x30,0x7d,0x61,0x62,0x62,0x72,0x5b,
+    0x74,0x69,0x74,0x6c,0x65,0x5d,0x7b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x62,0x6f,
+    0x74,0x74,0x6f,0x6d,0x3a,0x31,0x70,0x78,0x20,0x64,0x6f,0x74,0x74,0x65,0x64,0x7d,
+    0x62,0x2c,0x73,0x74,0x72,0x6f,0x6e,0x67,0x7b,0x66,0x6f,0x6e,0x74,0x2d,0x77,0x65,
+    0x69,0x67,0x68,0x74,0x3a,0x62,0x6f,0x6c,0x64,0x7d,0x64,0x66,0x6e,0x7b,0x66,0x6f,
+    0x6e,0x74,0x2d,0x73,0x74,0x79,0x6c,0x65,0x3a,0x69,0x74,0x61,0x6c,0x69,0x63,0x7d,
+    0x6d,0x61,0x72,0x6b,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,
+    0x23,0x66,0x66,0x30,0x3b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x30,0x30,0x30,0x7d,
+    0x73,0x6d,0x61,0x6c,0x6c,0x7b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,
+    0x38,0x30,0x25,0x7d,0x73,0x75,0x62,0x2c,0x73,0x75,0x70,0x7b,0x66,0x6f,0x6e,0x74,
+    0x2d,0x73,0x69,0x7a,0x65,0x3a,0x37,0x35,0x25,0x3b,0x6c,0x69,0x6e,0x65,0x2d,0x68,
+    0x65,0x69,0x67,0x68,0x74,0x3a,0x30,0x3b,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x3a,0x72,0x65,0x6c,0x61,0x74,0x69,0x76,0x65,0x3b,0x76,0x65,0x72,0x74,0x69,0x63,
+    0x61,0x6c,0x2d,0x61,0x6c,0x69,0x67,0x6e,0x3a,0x62,0x61,0x73,0x65,0x6c,0x69,0x6e,
+    0x65,0x7d,0x73,0x75,0x70,0x7b,0x74,0x6f,0x70,0x3a,0x2d,0x30,0x2e,0x35,0x65,0x6d,
+    0x7d,0x73,0x75,0x62,0x7b,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x3a,0x2d,0x30,0x2e,0x32,
+    0x35,0x65,0x6d,0x7d,0x69,0x6d,0x67,0x7b,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,0x30,
+    0x7d,0x73,0x76,0x67,0x3a,0x6e,0x6f,0x74,0x28,0x3a,0x72,0x6f,0x6f,0x74,0x29,0x7b,
+    0x6f,0x76,0x65,0x72,0x66,0x6c,0x6f,0x77,0x3a,0x68,0x69,0x64,0x64,0x65,0x6e,0x7d,
+    0x66,0x69,0x67,0x75,0x72,0x65,0x7b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x3a,0x31,0x65,
+    0x6d,0x20,0x34,0x30,0x70,0x78,0x7d,0x68,0x72,0x7b,0x2d,0x6d,0x6f,0x7a,0x2d,0x62,
+    0x6f,0x78,0x2d,0x73,0x69,0x7a,0x69,0x6e,0x67,0x3a,0x63,0x6f,0x6e,0x74,0x65,0x6e,
+    0x74,0x2d,0x62,0x6f,0x78,0x3b,0x62,0x6f,0x78,0x2d,0x73,0x69,0x7a,0x69,0x6e,0x67,
+    0x3a,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x62,0x6f,0x78,0x7d,0x63,0x6f,0x64,
+    0x65,0x2c,0x6b,0x62,0x64,0x2c,0x70,0x72,0x65,0x2c,0x73,0x61,0x6d,0x70,0x7b,0x66,
+    0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x6d,0x6f,0x6e,0x6f,0x73,
+    0x70,0x61,0x63,0x65,0x2c,0x6d,0x6f,0x6e,0x6f,0x73,0x70,0x61,0x63,0x65,0x3b,0x66,
+    0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x31,0x65,0x6d,0x7d,0x62,0x75,0x74,
+    0x74,0x6f,0x6e,0x2c,0x69,0x6e,0x70,0x75,0x74,0x2c,0x6f,0x70,0x74,0x67,0x72,0x6f,
+    0x75,0x70,0x2c,0x73,0x65,0x6c,0x65,0x63,0x74,0x2c,0x74,0x65,0x78,0x74,0x61,0x72,
+    0x65,0x61,0x7b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x69,0x6e,0x68,0x65,0x72,0x69,0x74,
+    0x3b,0x66,0x6f,0x6e,0x74,0x3a,0x69,0x6e,0x68,0x65,0x72,0x69,0x74,0x3b,0x6d,0x61,
+    0x72,0x67,0x69,0x6e,0x3a,0x30,0x7d,0x62,0x75,0x74,0x74,0x6f,0x6e,0x7b,0x6f,0x76,
+    0x65,0x72,0x66,0x6c,0x6f,0x77,0x3a,0x76,0x69,0x73,0x69,0x62,0x6c,0x65,0x7d,0x62,
+    0x75,0x74,0x74,0x6f,0x6e,0x2c,0x73,0x65,0x6c,0x65,0x63,0x74,0x7b,0x74,0x65,0x78,
+    0x74,0x2d,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x3a,0x6e,0x6f,0x6e,0x65,
+    0x7d,0x62,0x75,0x74,0x74,0x6f,0x6e,0x2c,0x68,0x74,0x6d,0x6c,0x20,0x69,0x6e,0x70,
+    0x75,0x74,0x5b,0x74,0x79,0x70,0x65,0x3d,0x62,0x75,0x74,0x74,0x6f,0x6e,0x5d,0x2c,
+    0x69,0x6e,0x70,0x75,0x74,0x5b,0x74,0x79,0x70,0x65,0x3d,0x72,0x65,0x73,0x65,0x74,
+    0x5d,0x2c,0x69,0x6e,0x70,0x75,0x74,0x5b,0x74,0x79,0x70,0x65,0x3d,0x73,0x75,0x62,
+    0x6d,0x69,0x74,0x5d,0x7b,0x2d,0x77,0x65,0x62,0x6b,0x69,0x74,0x2d,0x61,0x70,0x70,
+    0x65,0x61,0x72,0x61,0x6e,0x63,0x65,0x3a,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3b,0x63,
+    0x75,0x72,0x73,0x6f,0x72,0x3a,0x70,0x6f,0x69,0x6e,0x74,0x65,0x72,0x7d,0x62,0x75,
+    0x74,0x74,0x6f,0x6e,0x5b,0x64,0x69,0x73,0x61,0x62,0x6c,0x65,0x64,0x5d,0x2c,0x68,
+    0x74,0x6d,0x6c,0x20,0x69,0x6e,0x70,0x75,0x74,0x5b,0x64,0x69,0x73,0x61,0x62,0x6c,
+    0x65,0x64,0x5d,0x7b,0x63,0x75,0x72,0x73,0x6f,0x72,0x3a,0x64,0x65,0x66,0x61,0x75,
+    0x6c,0x74,0x7d,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3a,0x3a,0x2d,0x6d,0x6f,0x7a,0x2d,
+    0x66,0x6f,0x63,0x75,0x73,0x2d,0x69,0x6e,0x6e,0x65,0x72,0x2c,0x69,0x6e,0x70,0x75,
+    0x74,0x3a,0x3a,0x2d,0x6d,0x6f,0x7a,0x2d,0x66,0x6f,0x63,0x75,0x73,0x2d,0x69,0x6e,
+    0x6e,0x65,0x72,0x7b,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,0x30,0x3b,0x70,0x61,0x64,
+    0x64,0x69,0x6e,0x67,0x3a,0x30,0x7d,0x69,0x6e,0x70,0x75,0x74,0x5b,0x74,0x79,0x70,
+    0x65,0x3d,0x63,0x68,0x65,0x63,0x6b,0x62,0x6f,0x78,0x5d,0x2c,0x69,0x6e,0x70,0x75,
+    0x74,0x5b,0x74,0x79,0x70,0x65,0x3d,0x72,0x61,0x64,0x69,0x6f,0x5d,0x7b,0x70,0x61,
+    0x64,0x64,0x69,0x6e,0x67,0x3a,0x30,0x7d,0x69,0x6e,0x70,0x75,0x74,0x5b,0x74,0x79,
+    0x70,0x65,0x3d,0x6e,0x75,0x6d,0x62,0x65,0x72,0x5d,0x3a,0x3a,0x2d,0x77,0x65,0x62,
+    0x6b,0x69,0x74,0x2d,0x69,0x6e,0x6e,0x65,0x72,0x2d,0x73,0x70,0x69,0x6e,0x2d,0x62,
+    0x75,0x74,0x74,0x6f,0x6e,0x2c,0x69,0x6e,0x70,0x75,0x74,0x5b,0x74,0x79,0x70,0x65,
+    0x3d,0x6e,0x75,0x6d,0x62,0x65,0x72,0x5d,0x3a,0x3a,0x2d,0x77,0x65,0x62,0x6b,0x69,
+    0x74,0x2d,0x6f,0x75,0x74,0x65,0x72,0x2d,0x73,0x70,0x69,0x6e,0x2d,0x62,0x75,0x74,
+    0x74,0x6f,0x6e,0x7b,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x61,0x75,0x74,0x6f,0x7d,
+    0x69,0x6e,0x70,0x75,0x74,0x5b,0x74,0x79,0x70,0x65,0x3d,0x73,0x65,0x61,0x72,0x63,
+    0x68,0x5d,0x7b,0x62,0x6f,0x78,0x2d,0x73,0x69,0x7a,0x69,0x6e,0x67,0x3a,0x63,0x6f,
+    0x6e,0x74,0x65,0x6e,0x74,0x2d,0x62,0x6f,0x78,0x3b,0x2d,0x77,0x65,0x62,0x6b,0x69,
+    0x74,0x2d,0x61,0x70,0x70,0x65,0x61,0x72,0x61,0x6e,0x63,0x65,0x3a,0x74,0x65,0x78,
+    0x74,0x66,0x69,0x65,0x6c,0x64,0x3b,0x2d,0x6d,0x6f,0x7a,0x2d,0x62,0x6f,0x78,0x2d,
+    0x73,0x69,0x7a,0x69,0x6e,0x67,0x3a,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x62,
+    0x6f,0x78,0x3b,0x2d,0x77,0x65,0x62,0x6b,0x69,0x74,0x2d,0x62,0x6f,0x78,0x2d,0x73,
+    0x69,0x7a,0x69,0x6e,0x67,0x3a,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x62,0x6f,
+    0x78,0x7d,0x69,0x6e,0x70,0x75,0x74,0x5b,0x74,0x79,0x70,0x65,0x3d,0x73,0x65,0x61,
+    0x72,0x63,0x68,0x5d,0x3a,0x3a,0x2d,0x77,0x65,0x62,0x6b,0x69,0x74,0x2d,0x73,0x65,
+    0x61,0x72,0x63,0x68,0x2d,0x63,0x61,0x6e,0x63,0x65,0x6c,0x2d,0x62,0x75,0x74,0x74,
+    0x6f,0x6e,0x2c,0x69,0x6e,0x70,0x75,0x74,0x5b,0x74,0x79,0x70,0x65,0x3d,0x73,0x65,
+    0x61,0x72,0x63,0x68,0x5d,0x3a,0x3a,0x2d,0x77,0x65,0x62,0x6b,0x69,0x74,0x2d,0x73,
+    0x65,0x61,0x72,0x63,0x68,0x2d,0x64,0x65,0x63,0x6f,0x72,0x61,0x74,0x69,0x6f,0x6e,
+    0x7b,0x2d,0x77,0x65,0x62,0x6b,0x69,0x74,0x2d,0x61,0x70,0x70,0x65,0x61,0x72,0x61,
+    0x6e,0x63,0x65,0x3a,0x6e,0x6f,0x6e,0x65,0x7d,0x66,0x69,0x65,0x6c,0x64,0x73,0x65,
+    0x74,0x7b,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,0x31,0x70,0x78,0x20,0x73,0x6f,0x6c,
+    0x69,0x64,0x20,0x23,0x63,0x30,0x63,0x30,0x63,0x30,0x3b,0x6d,0x61,0x72,0x67,0x69,
+    0x6e,0x3a,0x30,0x20,0x32,0x70,0x78,0x3b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,
+    0x30,0x2e,0x33,0x35,0x65,0x6d,0x20,0x30,0x2e,0x36,0x32,0x35,0x65,0x6d,0x20,0x30,
+    0x2e,0x37,0x35,0x65,0x6d,0x7d,0x6c,0x65,0x67,0x65,0x6e,0x64,0x7b,0x62,0x6f,0x72,
+    0x64,0x65,0x72,0x3a,0x30,0x3b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x30,0x7d,
+    0x70,0x72,0x65,0x2c,0x74,0x65,0x78,0x74,0x61,0x72,0x65,0x61,0x7b,0x6f,0x76,0x65,
+    0x72,0x66,0x6c,0x6f,0x77,0x3a,0x61,0x75,0x74,0x6f,0x7d,0x6f,0x70,0x74,0x67,0x72,
+    0x6f,0x75,0x70,0x7b,0x66,0x6f,0x6e,0x74,0x2d,0x77,0x65,0x69,0x67,0x68,0x74,0x3a,
+    0x62,0x6f,0x6c,0x64,0x7d,0x68,0x74,0x6d,0x6c,0x2c,0x62,0x6f,0x64,0x79,0x7b,0x66,
+    0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x56,0x65,0x72,0x64,0x61,
+    0x6e,0x61,0x2c,0x73,0x61,0x6e,0x73,0x2d,0x73,0x65,0x72,0x69,0x66,0x3b,0x66,0x6f,
+    0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x31,0x35,0x70,0x78,0x3b,0x6c,0x69,0x6e,
+    0x65,0x2d,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x31,0x2e,0x35,0x7d,0x68,0x31,0x2c,
+    0x68,0x32,0x2c,0x68,0x33,0x2c,0x68,0x34,0x2c,0x68,0x35,0x2c,0x68,0x36,0x7b,0x66,
+    0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x22,0x53,0x65,0x67,0x6f,
+    0x65,0x20,0x55,0x49,0x22,0x2c,0x41,0x72,0x69,0x61,0x6c,0x2c,0x73,0x61,0x6e,0x73,
+    0x2d,0x73,0x65,0x72,0x69,0x66,0x7d,0x68,0x31,0x7b,0x66,0x6f,0x6e,0x74,0x2d,0x73,
+    0x69,0x7a,0x65,0x3a,0x33,0x36,0x70,0x78,0x7d,0x68,0x32,0x7b,0x66,0x6f,0x6e,0x74,
+    0x2d,0x73,0x69,0x7a,0x65,0x3a,0x33,0x30,0x70,0x78,0x7d,0x68,0x33,0x7b,0x66,0x6f,
+    0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x32,0x34,0x70,0x78,0x7d,0x68,0x34,0x7b,
+    0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x32,0x30,0x70,0x78,0x7d,0x68,
+    0x35,0x7b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x31,0x38,0x70,0x78,
+    0x7d,0x68,0x36,0x7b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x31,0x36,
+    0x70,0x78,0x7d,0x68,0x31,0x2c,0x68,0x32,0x2c,0x68,0x33,0x2c,0x68,0x34,0x2c,0x68,
+    0x35,0x2c,0x68,0x36,0x7b,0x66,0x6f,0x6e,0x74,0x2d,0x77,0x65,0x69,0x67,0x68,0x74,
+    0x3a,0x34,0x30,0x30,0x3b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x3a,0x31,0x30,0x70,0x78,
+    0x20,0x30,0x7d,0x68,0x31,0x20,0x61,0x2c,0x68,0x32,0x20,0x61,0x2c,0x68,0x33,0x20,
+    0x61,0x2c,0x68,0x34,0x20,0x61,0x2c,0x68,0x35,0x20,0x61,0x2c,0x68,0x36,0x20,0x61,
+    0x7b,0x66,0x6f,0x6e,0x74,0x2d,0x77,0x65,0x69,0x67,0x68,0x74,0x3a,0x69,0x6e,0x68,
+    0x65,0x72,0x69,0x74,0x7d,0x68,0x72,0x7b,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x30,
+    0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,0x30,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,
+    0x2d,0x74,0x6f,0x70,0x3a,0x31,0x70,0x78,0x20,0x73,0x6f,0x6c,0x69,0x64,0x20,0x23,
+    0x65,0x65,0x65,0x3b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x3a,0x32,0x30,0x70,0x78,0x20,
+    0x30,0x7d,0x69,0x6d,0x67,0x7b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x62,0x6f,0x74,
+    0x74,0x6f,0x6d,0x3a,0x2d,0x35,0x70,0x78,0x7d,0x61,0x7b,0x63,0x6f,0x6c,0x6f,0x72,
+    0x3a,0x69,0x6e,0x68,0x65,0x72,0x69,0x74,0x7d,0x74,0x61,0x62,0x6c,0x65,0x7b,0x62,
+    0x6f,0x72,0x64,0x65,0x72,0x2d,0x63,0x6f,0x6c,0x6c,0x61,0x70,0x73,0x65,0x3a,0x63,
+    0x6f,0x6c,0x6c,0x61,0x70,0x73,0x65,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x73,
+    0x70,0x61,0x63,0x69,0x6e,0x67,0x3a,0x30,0x3b,0x77,0x69,0x64,0x74,0x68,0x3a,0x31,
+    0x30,0x30,0x25,0x3b,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x74,0x61,0x62,0x6c,
+    0x65,0x7d,0x74,0x61,0x62,0x6c,0x65,0x2c,0x74,0x68,0x2c,0x74,0x64,0x7b,0x62,0x6f,
+    0x72,0x64,0x65,0x72,0x3a,0x6e,0x6f,0x6e,0x65,0x7d,0x2e,0x77,0x33,0x2d,0x62,0x6f,
+    0x72,0x64,0x65,0x72,0x65,0x64,0x20,0x74,0x72,0x7b,0x62,0x6f,0x72,0x64,0x65,0x72,
+    0x2d,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x3a,0x31,0x70,0x78,0x20,0x73,0x6f,0x6c,0x69,
+    0x64,0x20,0x23,0x64,0x64,0x64,0x7d,0x2e,0x77,0x33,0x2d,0x73,0x74,0x72,0x69,0x70,
+    0x65,0x64,0x20,0x74,0x62,0x6f,0x64,0x79,0x20,0x74,0x72,0x3a,0x6e,0x74,0x68,0x2d,
+    0x63,0x68,0x69,0x6c,0x64,0x28,0x65,0x76,0x65,0x6e,0x29,0x7b,0x62,0x61,0x63,0x6b,
+    0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x66,0x31,
+    0x66,0x31,0x66,0x31,0x7d,0x2e,0x77,0x33,0x2d,0x74,0x61,0x62,0x6c,0x65,0x20,0x74,
+    0x64,0x2c,0x2e,0x77,0x33,0x2d,0x74,0x61,0x62,0x6c,0x65,0x20,0x74,0x68,0x7b,0x70,
+    0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x36,0x70,0x78,0x20,0x38,0x70,0x78,0x3b,0x64,
+    0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x74,0x61,0x62,0x6c,0x65,0x2d,0x63,0x65,0x6c,
+    0x6c,0x3b,0x74,0x65,0x78,0x74,0x2d,0x61,0x6c,0x69,0x67,0x6e,0x3a,0x6c,0x65,0x66,
+    0x74,0x3b,0x76,0x65,0x72,0x74,0x69,0x63,0x61,0x6c,0x2d,0x61,0x6c,0x69,0x67,0x6e,
+    0x3a,0x74,0x6f,0x70,0x7d,0x2e,0x77,0x33,0x2d,0x74,0x61,0x62,0x6c,0x65,0x20,0x74,
+    0x68,0x3a,0x66,0x69,0x72,0x73,0x74,0x2d,0x63,0x68,0x69,0x6c,0x64,0x2c,0x2e,0x77,
+    0x33,0x2d,0x74,0x61,0x62,0x6c,0x65,0x20,0x74,0x64,0x3a,0x66,0x69,0x72,0x73,0x74,
+    0x2d,0x63,0x68,0x69,0x6c,0x64,0x7b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x2d,0x6c,
+    0x65,0x66,0x74,0x3a,0x31,0x36,0x70,0x78,0x7d,0x2e,0x77,0x33,0x2d,0x6e,0x61,0x76,
+    0x62,0x61,0x72,0x7b,0x6c,0x69,0x73,0x74,0x2d,0x73,0x74,0x79,0x6c,0x65,0x2d,0x74,
+    0x79,0x70,0x65,0x3a,0x6e,0x6f,0x6e,0x65,0x3b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x3a,
+    0x30,0x3b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x30,0x3b,0x6f,0x76,0x65,0x72,
+    0x66,0x6c,0x6f,0x77,0x3a,0x68,0x69,0x64,0x64,0x65,0x6e,0x7d,0x2e,0x77,0x33,0x2d,
+    0x6e,0x61,0x76,0x62,0x61,0x72,0x20,0x6c,0x69,0x7b,0x66,0x6c,0x6f,0x61,0x74,0x3a,
+    0x6c,0x65,0x66,0x74,0x7d,0x2e,0x77,0x33,0x2d,0x6e,0x61,0x76,0x62,0x61,0x72,0x20,
+    0x6c,0x69,0x20,0x61,0x7b,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x62,0x6c,0x6f,
+    0x63,0x6b,0x3b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x38,0x70,0x78,0x20,0x31,
+    0x36,0x70,0x78,0x7d,0x2e,0x77,0x33,0x2d,0x6e,0x61,0x76,0x62,0x61,0x72,0x20,0x6c,
+    0x69,0x20,0x61,0x3a,0x68,0x6f,0x76,0x65,0x72,0x7b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,
+    0x23,0x30,0x30,0x30,0x3b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,
+    0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x63,0x63,0x63,0x7d,0x2e,0x77,0x33,0x2d,0x6e,
+    0x61,0x76,0x62,0x61,0x72,0x20,0x61,0x7b,0x74,0x65,0x78,0x74,0x2d,0x64,0x65,0x63,
+    0x6f,0x72,0x61,0x74,0x69,0x6f,0x6e,0x3a,0x6e,0x6f,0x6e,0x65,0x20,0x21,0x69,0x6d,
+    0x70,0x6f,0x72,0x74,0x61,0x6e,0x74,0x7d,0x2e,0x77,0x33,0x2d,0x6e,0x61,0x76,0x62,
+    0x61,0x72,0x20,0x61,0x7b,0x2d,0x77,0x65,0x62,0x6b,0x69,0x74,0x2d,0x74,0x72,0x61,
+    0x6e,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x61,0x6c,0x6c,0x20,0x30,0x2e,0x33,0x73,
+    0x20,0x65,0x61,0x73,0x65,0x3b,0x74,0x72,0x61,0x6e,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x3a,0x61,0x6c,0x6c,0x20,0x30,0x2e,0x33,0x73,0x20,0x65,0x61,0x73,0x65,0x7d,0x2e,
+    0x77,0x33,0x2d,0x63,0x6c,0x6f,0x73,0x65,0x62,0x74,0x6e,0x7b,0x74,0x65,0x78,0x74,
+    0x2d,0x64,0x65,0x63,0x6f,0x72,0x61,0x74,0x69,0x6f,0x6e,0x3a,0x6e,0x6f,0x6e,0x65,
+    0x3b,0x66,0x6c,0x6f,0x61,0x74,0x3a,0x72,0x69,0x67,0x68,0x74,0x3b,0x66,0x6f,0x6e,
+    0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x32,0x34,0x70,0x78,0x3b,0x66,0x6f,0x6e,0x74,
+    0x2d,0x77,0x65,0x69,0x67,0x68,0x74,0x3a,0x62,0x6f,0x6c,0x64,0x3b,0x63,0x6f,0x6c,
+    0x6f,0x72,0x3a,0x69,0x6e,0x68,0x65,0x72,0x69,0x74,0x7d,0x2e,0x77,0x33,0x2d,0x63,
+    0x6c,0x6f,0x73,0x65,0x62,0x74,0x6e,0x3a,0x68,0x6f,0x76,0x65,0x72,0x2c,0x2e,0x77,
+    0x33,0x2d,0x63,0x6c,0x6f,0x73,0x65,0x62,0x74,0x6e,0x3a,0x66,0x6f,0x63,0x75,0x73,
+    0x7b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x30,0x30,0x30,0x3b,0x74,0x65,0x78,0x74,
+    0x2d,0x64,0x65,0x63,0x6f,0x72,0x61,0x74,0x69,0x6f,0x6e,0x3a,0x6e,0x6f,0x6e,0x65,
+    0x3b,0x63,0x75,0x72,0x73,0x6f,0x72,0x3a,0x70,0x6f,0x69,0x6e,0x74,0x65,0x72,0x7d,
+    0x2e,0x77,0x33,0x2d,0x69,0x6e,0x70,0x75,0x74,0x7b,0x70,0x61,0x64,0x64,0x69,0x6e,
+    0x67,0x3a,0x38,0x70,0x78,0x3b,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x62,0x6c,
+    0x6f,0x63,0x6b,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,0x6e,0x6f,0x6e,0x65,0x3b,
+    0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x3a,0x31,0x70,
+    0x78,0x20,0x73,0x6f,0x6c,0x69,0x64,0x20,0x23,0x38,0x30,0x38,0x30,0x38,0x30,0x3b,
+    0x77,0x69,0x64,0x74,0x68,0x3a,0x31,0x30,0x30,0x25,0x7d,0x2e,0x77,0x33,0x2d,0x6c,
+    0x61,0x62,0x65,0x6c,0x7b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x30,0x30,0x39,0x36,
+    0x38,0x38,0x7d,0x2e,0x77,0x33,0x2d,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,
+    0x3a,0x61,0x66,0x74,0x65,0x72,0x2c,0x2e,0x77,0x33,0x2d,0x72,0x6f,0x77,0x2d,0x70,
+    0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x61,0x66,0x74,0x65,0x72,0x7b,0x63,0x6f,0x6e,
+    0x74,0x65,0x6e,0x74,0x3a,0x22,0x22,0x3b,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,
+    0x74,0x61,0x62,0x6c,0x65,0x3b,0x63,0x6c,0x65,0x61,0x72,0x3a,0x62,0x6f,0x74,0x68,
+    0x7d,0x2e,0x77,0x33,0x2d,0x63,0x6f,0x6c,0x2c,0x2e,0x77,0x33,0x2d,0x74,0x68,0x69,
+    0x72,0x64,0x7b,0x66,0x6c,0x6f,0x61,0x74,0x3a,0x6c,0x65,0x66,0x74,0x3b,0x77,0x69,
+    0x64,0x74,0x68,0x3a,0x31,0x30,0x30,0x25,0x7d,0x2e,0x77,0x33,0x2d,0x63,0x6f,0x6c,
+    0x2e,0x73,0x31,0x7b,0x77,0x69,0x64,0x74,0x68,0x3a,0x38,0x2e,0x33,0x33,0x33,0x33,
+    0x33,0x25,0x7d,0x2e,0x77,0x33,0x2d,0x63,0x6f,0x6c,0x2e,0x73,0x32,0x7b,0x77,0x69,
+    0x64,0x74,0x68,0x3a,0x31,0x36,0x2e,0x36,0x36,0x36,0x36,0x36,0x25,0x7d,0x2e,0x77,
+    0x33,0x2d,0x63,0x6f,0x6c,0x2e,0x73,0x33,0x7b,0x77,0x69,0x64,0x74,0x68,0x3a,0x32,
+    0x34,0x2e,0x39,0x39,0x39,0x39,0x39,0x25,0x7d,0x2e,0x77,0x33,0x2d,0x63,0x6f,0x6c,
+    0x2e,0x73,0x34,0x7b,0x77,0x69,0x64,0x74,0x68,0x3a,0x33,0x33,0x2e,0x33,0x33,0x33,
+    0x33,0x33,0x25,0x7d,0x2e,0x77,0x33,0x2d,0x63,0x6f,0x6c,0x2e,0x73,0x35,0x7b,0x77,
+    0x69,0x64,0x74,0x68,0x3a,0x34,0x31,0x2e,0x36,0x36,0x36,0x36,0x36,0x25,0x7d,0x2e,
+    0x77,0x33,0x2d,0x63,0x6f,0x6c,0x2e,0x73,0x36,0x7b,0x77,0x69,0x64,0x74,0x68,0x3a,
+    0x34,0x39,0x2e,0x39,0x39,0x39,0x39,0x39,0x25,0x7d,0x2e,0x77,0x33,0x2d,0x63,0x6f,
+    0x6c,0x2e,0x73,0x37,0x7b,0x77,0x69,0x64,0x74,0x68,0x3a,0x35,0x38,0x2e,0x33,0x33,
+    0x33,0x33,0x33,0x25,0x7d,0x2e,0x77,0x33,0x2d,0x63,0x6f,0x6c,0x2e,0x73,0x38,0x7b,
+    0x77,0x69,0x64,0x74,0x68,0x3a,0x36,0x36,0x2e,0x36,0x36,0x36,0x36,0x36,0x25,0x7d,
+    0x2e,0x77,0x33,0x2d,0x63,0x6f,0x6c,0x2e,0x73,0x39,0x7b,0x77,0x69,0x64,0x74,0x68,
+    0x3a,0x37,0x34,0x2e,0x39,0x39,0x39,0x39,0x39,0x25,0x7d,0x2e,0x77,0x33,0x2d,0x63,
+    0x6f,0x6c,0x2e,0x73,0x31,0x30,0x7b,0x77,0x69,0x64,0x74,0x68,0x3a,0x38,0x33,0x2e,
+    0x33,0x33,0x33,0x33,0x33,0x25,0x7d,0x2e,0x77,0x33,0x2d,0x63,0x6f,0x6c,0x2e,0x73,
+    0x31,0x31,0x7b,0x77,0x69,0x64,0x74,0x68,0x3a,0x39,0x31,0x2e,0x36,0x36,0x36,0x36,
+    0x36,0x25,0x7d,0x2e,0x77,0x33,0x2d,0x63,0x6f,0x6c,0x2e,0x73,0x31,0x32,0x2c,0x2e,
+    0x77,0x33,0x2d,0x74,0x68,0x69,0x72,0x64,0x7b,0x77,0x69,0x64,0x74,0x68,0x3a,0x39,
+    0x39,0x2e,0x39,0x39,0x39,0x39,0x39,0x25,0x7d,0x40,0x6d,0x65,0x64,0x69,0x61,0x20,
+    0x6f,0x6e,0x6c,0x79,0x20,0x73,0x63,0x72,0x65,0x65,0x6e,0x20,0x61,0x6e,0x64,0x20,
+    0x28,0x6d,0x69,0x6e,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x36,0x30,0x31,0x70,0x78,
+    0x29,0x7b,0x2e,0x77,0x33,0x2d,0x63,0x6f,0x6c,0x2e,0x6d,0x31,0x7b,0x77,0x69,0x64,
+    0x74,0x68,0x3a,0x38,0x2e,0x33,0x33,0x33,0x33,0x33,0x25,0x7d,0x2e,0x77,0x33,0x2d,
+    0x63,0x6f,0x6c,0x2e,0x6d,0x32,0x7b,0x77,0x69,0x64,0x74,0x68,0x3a,0x31,0x36,0x2e,
+    0x36,0x36,0x36,0x36,0x36,0x25,0x7d,0x2e,0x77,0x33,0x2d,0x63,0x6f,0x6c,0x2e,0x6d,
+    0x33,0x7b,0x77,0x69,0x64,0x74,0x68,0x3a,0x32,0x34,0x2e,0x39,0x39,0x39,0x39,0x39,
+    0x25,0x7d,0x2e,0x77,0x33,0x2d,0x63,0x6f,0x6c,0x2e,0x6d,0x34,0x2c,0x2e,0x77,0x33,
+    0x2d,0x74,0x68,0x69,0x72,0x64,0x7b,0x77,0x69,0x64,0x74,0x68,0x3a,0x33,0x33,0x2e,
+    0x33,0x33,0x33,0x33,0x33,0x25,0x7d,0x2e,0x77,0x33,0x2d,0x63,0x6f,0x6c,0x2e,0x6d,
+    0x35,0x7b,0x77,0x69,0x64,0x74,0x68,0x3a,0x34,0x31,0x2e,0x36,0x36,0x36,0x36,0x36,
+    0x25,0x7d,0x2e,0x77,0x33,0x2d,0x63,0x6f,0x6c,0x2e,0x6d,0x36,0x7b,0x77,0x69,0x64,
+    0x74,0x68,0x3a,0x34,0x39,0x2e,0x39,0x39,0x39,0x39,0x39,0x25,0x7d,0x2e,0x77,0x33,
+    0x2d,0x63,0x6f,0x6c,0x2e,0x6d,0x37,0x7b,0x77,0x69,0x64,0x74,0x68,0x3a,0x35,0x38,
+    0x2e,0x33,0x33,0x33,0x33,0x33,0x25,0x7d,0x2e,0x77,0x33,0x2d,0x63,0x6f,0x6c,0x2e,
+    0x6d,0x38,0x7b,0x77,0x69,0x64,0x74,0x68,0x3a,0x36,0x36,0x2e,0x36,0x36,0x36,0x36,
+    0x36,0x25,0x7d,0x2e,0x77,0x33,0x2d,0x63,0x6f,0x6c,0x2e,0x6d,0x39,0x7b,0x77,0x69,
+    0x64,0x74,0x68,0x3a,0x37,0x34,0x2e,0x39,0x39,0x39,0x39,0x39,0x25,0x7d,0x2e,0x77,
+    0x33,0x2d,0x63,0x6f,0x6c,0x2e,0x6d,0x31,0x30,0x7b,0x77,0x69,0x64,0x74,0x68,0x3a,
+    0x38,0x33,0x2e,0x33,0x33,0x33,0x33,0x33,0x25,0x7d,0x2e,0x77,0x33,0x2d,0x63,0x6f,
+    0x6c,0x2e,0x6d,0x31,0x31,0x7b,0x77,0x69,0x64,0x74,0x68,0x3a,0x39,0x31,0x2e,0x36,
+    0x36,0x36,0x36,0x36,0x25,0x7d,0x2e,0x77,0x33,0x2d,0x63,0x6f,0x6c,0x2e,0x6d,0x31,
+    0x32,0x7b,0x77,0x69,0x64,0x74,0x68,0x3a,0x39,0x39,0x2e,0x39,0x39,0x39,0x39,0x39,
+    0x25,0x7d,0x7d,0x40,0x6d,0x65,0x64,0x69,0x61,0x20,0x6f,0x6e,0x6c,0x79,0x20,0x73,
+    0x63,0x72,0x65,0x65,0x6e,0x20,0x61,0x6e,0x64,0x20,0x28,0x6d,0x69,0x6e,0x2d,0x77,
+    0x69,0x64,0x74,0x68,0x3a,0x39,0x39,0x33,0x70,0x78,0x29,0x7b,0x2e,0x77,0x33,0x2d,
+    0x63,0x6f,0x6c,0x2e,0x6c,0x31,0x7b,0x77,0x69,0x64,0x74,0x68,0x3a,0x38,0x2e,0x33,
+    0x33,0x33,0x33,0x33,0x25,0x7d,0x2e,0x77,0x33,0x2d,0x63,0x6f,0x6c,0x2e,0x6c,0x32,
+    0x7b,0x77,0x69,0x64,0x74,0x68,0x3a,0x31,0x36,0x2e,0x36,0x36,0x36,0x36,0x36,0x25,
+    0x7d,0x2e,0x77,0x33,0x2d,0x63,0x6f,0x6c,0x2e,0x6c,0x33,0x7b,0x77,0x69,0x64,0x74,
+    0x68,0x3a,0x32,0x34,0x2e,0x39,0x39,0x39,0x39,0x39,0x25,0x7d,0x2e,0x77,0x33,0x2d,
+    0x63,0x6f,0x6c,0x2e,0x6c,0x34,0x2c,0x2e,0x77,0x33,0x2d,0x74,0x68,0x69,0x72,0x64,
+    0x7b,0x77,0x69,0x64,0x74,0x68,0x3a,0x33,0x33,0x2e,0x33,0x33,0x33,0x33,0x33,0x25,
+    0x7d,0x2e,0x77,0x33,0x2d,0x63,0x6f,0x6c,0x2e,0x6c,0x35,0x7b,0x77,0x69,0x64,0x74,
+    0x68,0x3a,0x34,0x31,0x2e,0x36,0x36,0x36,0x36,0x36,0x25,0x7d,0x2e,0x77,0x33,0x2d,
+    0x63,0x6f,0x6c,0x2e,0x6c,0x36,0x7b,0x77,0x69,0x64,0x74,0x68,0x3a,0x34,0x39,0x2e,
+    0x39,0x39,0x39,0x39,0x39,0x25,0x7d,0x2e,0x77,0x33,0x2d,0x63,0x6f,0x6c,0x2e,0x6c,
+    0x37,0x7b,0x77,0x69,0x64,0x74,0x68,0x3a,0x35,0x38,0x2e,0x33,0x33,0x33,0x33,0x33,
+    0x25,0x7d,0x2e,0x77,0x33,0x2d,0x63,0x6f,0x6c,0x2e,0x6c,0x38,0x7b,0x77,0x69,0x64,
+    0x74,0x68,0x3a,0x36,0x36,0x2e,0x36,0x36,0x36,0x36,0x36,0x25,0x7d,0x2e,0x77,0x33,
+    0x2d,0x63,0x6f,0x6c,0x2e,0x6c,0x39,0x7b,0x77,0x69,0x64,0x74,0x68,0x3a,0x37,0x34,
+    0x2e,0x39,0x39,0x39,0x39,0x39,0x25,0x7d,0x2e,0x77,0x33,0x2d,0x63,0x6f,0x6c,0x2e,
+    0x6c,0x31,0x30,0x7b,0x77,0x69,0x64,0x74,0x68,0x3a,0x38,0x33,0x2e,0x33,0x33,0x33,
+    0x33,0x33,0x25,0x7d,0x2e,0x77,0x33,0x2d,0x63,0x6f,0x6c,0x2e,0x6c,0x31,0x31,0x7b,
+    0x77,0x69,0x64,0x74,0x68,0x3a,0x39,0x31,0x2e,0x36,0x36,0x36,0x36,0x36,0x25,0x7d,
+    0x2e,0x77,0x33,0x2d,0x63,0x6f,0x6c,0x2e,0x6c,0x31,0x32,0x7b,0x77,0x69,0x64,0x74,
+    0x68,0x3a,0x39,0x39,0x2e,0x39,0x39,0x39,0x39,0x39,0x25,0x7d,0x7d,0x40,0x6d,0x65,
+    0x64,0x69,0x61,0x20,0x73,0x63,0x72,0x65,0x65,0x6e,0x20,0x61,0x6e,0x64,0x20,0x28,
+    0x6d,0x61,0x78,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x36,0x30,0x31,0x70,0x78,0x29,
+    0x7b,0x2e,0x77,0x33,0x2d,0x6e,0x61,0x76,0x62,0x61,0x72,0x20,0x6c,0x69,0x7b,0x66,
+    0x6c,0x6f,0x61,0x74,0x3a,0x6e,0x6f,0x6e,0x65,0x7d,0x7d,0x40,0x6d,0x65,0x64,0x69,
+    0x61,0x20,0x73,0x63,0x72,0x65,0x65,0x6e,0x20,0x61,0x6e,0x64,0x20,0x28,0x6d,0x61,
+    0x78,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x36,0x30,0x31,0x70,0x78,0x29,0x7b,0x2e,
+    0x77,0x33,0x2d,0x6e,0x61,0x76,0x62,0x61,0x72,0x7b,0x74,0x65,0x78,0x74,0x2d,0x61,
+    0x6c,0x69,0x67,0x6e,0x3a,0x63,0x65,0x6e,0x74,0x65,0x72,0x7d,0x7d,0x2e,0x77,0x33,
+    0x2d,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x2d,0x36,0x34,0x7b,0x70,0x61,0x64,0x64,
+    0x69,0x6e,0x67,0x2d,0x74,0x6f,0x70,0x3a,0x36,0x34,0x70,0x78,0x20,0x21,0x69,0x6d,
+    0x70,0x6f,0x72,0x74,0x61,0x6e,0x74,0x3b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x2d,
+    0x62,0x6f,0x74,0x74,0x6f,0x6d,0x3a,0x36,0x34,0x70,0x78,0x20,0x21,0x69,0x6d,0x70,
+    0x6f,0x72,0x74,0x61,0x6e,0x74,0x7d,0x2e,0x77,0x33,0x2d,0x72,0x6f,0x77,0x2d,0x70,
+    0x61,0x64,0x64,0x69,0x6e,0x67,0x2c,0x2e,0x77,0x33,0x2d,0x72,0x6f,0x77,0x2d,0x70,
+    0x61,0x64,0x64,0x69,0x6e,0x67,0x3e,0x2e,0x77,0x33,0x2d,0x74,0x68,0x69,0x72,0x64,
+    0x2c,0x2e,0x77,0x33,0x2d,0x72,0x6f,0x77,0x2d,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,
+    0x3e,0x2e,0x77,0x33,0x2d,0x63,0x6f,0x6c,0x7b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,
+    0x3a,0x30,0x20,0x38,0x70,0x78,0x7d,0x2e,0x77,0x33,0x2d,0x63,0x6f,0x6e,0x74,0x61,
+    0x69,0x6e,0x65,0x72,0x7b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x30,0x2e,0x30,
+    0x31,0x65,0x6d,0x20,0x31,0x36,0x70,0x78,0x7d,0x2e,0x77,0x33,0x2d,0x73,0x65,0x63,
+    0x74,0x69,0x6f,0x6e,0x7b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x74,0x6f,0x70,0x3a,
+    0x31,0x36,0x70,0x78,0x3b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x62,0x6f,0x74,0x74,
+    0x6f,0x6d,0x3a,0x31,0x36,0x70,0x78,0x7d,0x2e,0x77,0x33,0x2d,0x63,0x61,0x72,0x64,
+    0x2d,0x34,0x7b,0x62,0x6f,0x78,0x2d,0x73,0x68,0x61,0x64,0x6f,0x77,0x3a,0x30,0x20,
+    0x34,0x70,0x78,0x20,0x38,0x70,0x78,0x20,0x30,0x20,0x72,0x67,0x62,0x61,0x28,0x30,
+    0x2c,0x30,0x2c,0x30,0x2c,0x30,0x2e,0x32,0x29,0x2c,0x30,0x20,0x36,0x70,0x78,0x20,
+    0x32,0x30,0x70,0x78,0x20,0x30,0x20,0x72,0x67,0x62,0x61,0x28,0x30,0x2c,0x30,0x2c,
+    0x30,0x2c,0x30,0x2e,0x31,0x39,0x29,0x20,0x21,0x69,0x6d,0x70,0x6f,0x72,0x74,0x61,
+    0x6e,0x74,0x7d,0x2e,0x77,0x33,0x2d,0x6c,0x69,0x67,0x68,0x74,0x2d,0x62,0x6c,0x75,
+    0x65,0x7b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x30,0x30,0x30,0x20,0x21,0x69,0x6d,
+    0x70,0x6f,0x72,0x74,0x61,0x6e,0x74,0x3b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,
+    0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x38,0x37,0x43,0x45,0x45,0x42,
+    0x20,0x21,0x69,0x6d,0x70,0x6f,0x72,0x74,0x61,0x6e,0x74,0x7d,0x2e,0x77,0x33,0x2d,
+    0x67,0x72,0x65,0x65,0x6e,0x7b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x66,0x66,0x66,
+    0x20,0x21,0x69,0x6d,0x70,0x6f,0x72,0x74,0x61,0x6e,0x74,0x3b,0x62,0x61,0x63,0x6b,
+    0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x34,0x43,
+    0x41,0x46,0x35,0x30,0x20,0x21,0x69,0x6d,0x70,0x6f,0x72,0x74,0x61,0x6e,0x74,0x7d,
+    0x2e,0x77,0x33,0x2d,0x74,0x65,0x61,0x6c,0x7b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,
+    0x66,0x66,0x66,0x20,0x21,0x69,0x6d,0x70,0x6f,0x72,0x74,0x61,0x6e,0x74,0x3b,0x62,
+    0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,
+    0x23,0x30,0x30,0x39,0x36,0x38,0x38,0x20,0x21,0x69,0x6d,0x70,0x6f,0x72,0x74,0x61,
+    0x6e,0x74,0x7d,0x2e,0x77,0x33,0x2d,0x77,0x68,0x69,0x74,0x65,0x7b,0x63,0x6f,0x6c,
+    0x6f,0x72,0x3a,0x23,0x30,0x30,0x30,0x20,0x21,0x69,0x6d,0x70,0x6f,0x72,0x74,0x61,
+    0x6e,0x74,0x3b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,
+    0x6c,0x6f,0x72,0x3a,0x23,0x66,0x66,0x66,0x20,0x21,0x69,0x6d,0x70,0x6f,0x72,0x74,
+    0x61,0x6e,0x74,0x7d,
+};
+
+// /w3.css.gz, 1797 bytes
+static const uint8_t bundle_w3_css_gz[] PROGMEM={
+    0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x95,0x58,0x5b,0x6f,0xe3,0xb8,
+    0x15,0x7e,0xef,0xaf,0x60,0x27,0x58,0x60,0x32,0x90,0xbc,0xf2,0x35,0x89,0x84,0x16,
+    0xdd,0x9d,0x4e,0x81,0xee,0xe3,0x0e,0xda,0x3e,0x04,0x79,0xa0,0x44,0xca,0x62,0x43,
+    0x91,0x02,0x49,0xe7,0xb2,0x82,0xfe,0x7b,0x0f,0x49,0x49,0xa6,0x2c,0x2b,0x98,0xda,
+    0x80,0x63,0x9f,0x43,0x9e,0xcb,0x77,0xae,0xca,0xcf,0x5f,0xd0,0x7f,0xb6,0xab,0xaf,
+    0xdf,0xbf,0xa3,0xcd,0x2a,0x41,0xf9,0x3b,0xfa,0x0d,0x0b,0xf4,0xed,0xc8,0x38,0xc2,
+    0x82,0xa0,0x5f,0xa5,0x3a,0x52,0xf4,0x3b,0x2d,0xb5,0xa0,0x7a,0x85,0xfe,0x2e,0x91,
+    0x90,0x06,0x29,0x5a,0xcb,0x17,0x8a,0x4c,0xc5,0x34,0xe2,0x4c,0xd0,0x15,0xfa,0xf2,
+    0xf3,0x9f,0xbe,0xb4,0xf1,0x2b,0xcd,0x9f,0x99,0x89,0x73,0xf9,0x16,0x6b,0xf6,0x07,
+    0x13,0xc7,0x34,0x97,0x8a,0x50,0x65,0x29,0x59,0x5c,0xcb,0x3f,0x16,0x58,0x57,0xa9,
+    0x5d,0x65,0x6a,0xde,0xc6,0xb5,0x8e,0x0d,0x7d,0x33,0x96,0x4f,0x63,0x4c,0xfe,0x7b,
+    0xd2,0x26,0x5d,0x27,0xc9,0x4f,0xd9,0xa0,0xed,0x2a,0xb7,0xcb,0x25,0x79,0x6f,0x6b,
+    0xac,0x8e,0x4c,0xa4,0x49,0x87,0x95,0x61,0x05,0xa7,0x11,0xd6,0x8c,0xd0,0x88,0x50,
+    0x83,0x19,0xd7,0x51,0xc9,0x8e,0x05,0x6e,0x0c,0x93,0xc2,0x7e,0x3d,0x29,0x1a,0x95,
+    0x52,0x1a,0xaa,0xa2,0x8a,0x62,0x62,0xff,0x1c,0x95,0x3c,0x35,0x51,0x8d,0x99,0x88,
+    0x6a,0x2a,0x4e,0x91,0xc0,0x2f,0x91,0xa6,0x85,0xbb,0xa1,0x4f,0x35,0x88,0x7f,0x6f,
+    0x09,0xd3,0x0d,0xc7,0xef,0x69,0xce,0x65,0xf1,0xdc,0xe1,0x13,0x61,0x32,0x2a,0xb0,
+    0x78,0xc1,0x3a,0x7a,0x01,0x65,0x72,0x3c,0xc0,0x84,0x85,0x2a,0x76,0xe7,0xb2,0x17,
+    0x6a,0x2d,0xc2,0x3c,0xc6,0x9c,0x1d,0x45,0x9a,0x63,0x4d,0x2d,0xd7,0xdf,0x4f,0x01,
+    0xe3,0xcf,0x8f,0x85,0x14,0x46,0x49,0xae,0x9f,0x6e,0x47,0x11,0x42,0x0a,0x9a,0x55,
+    0x94,0x1d,0x2b,0x03,0x4e,0x3d,0x56,0x8c,0x10,0x2a,0x9e,0x22,0x43,0x6b,0x60,0x1b,
+    0x3a,0x39,0xd7,0xe1,0x31,0x1e,0x06,0x37,0x71,0x05,0x97,0xb8,0xbd,0x18,0x17,0x92,
+    0x4b,0x95,0x1a,0x85,0x85,0x6e,0xb0,0xa2,0xc2,0x64,0x39,0x2e,0x9e,0xad,0xab,0x82,
+    0xcc,0x99,0x1d,0x4e,0x31,0x38,0xfc,0x02,0xd8,0xa5,0x15,0x04,0x5d,0xb5,0xf2,0x64,
+    0xac,0xa9,0x16,0xd5,0x3c,0x57,0x8f,0x86,0x19,0x4e,0x9f,0xda,0x31,0x6e,0xc6,0xc8,
+    0x3a,0x5d,0x37,0x6f,0x88,0xc0,0x57,0x4a,0xba,0x3c,0xd2,0xe0,0x86,0x38,0xb6,0x25,
+    0xf8,0x03,0x16,0x39,0xe3,0x73,0xc9,0x49,0x47,0x4a,0xe1,0x89,0xda,0xbc,0x73,0x9a,
+    0x32,0x03,0x58,0x14,0x1d,0x80,0xfa,0xdc,0x9e,0x2d,0x4a,0x6f,0xca,0x32,0xc9,0xbc,
+    0x59,0x37,0x49,0x92,0x74,0xba,0xc6,0x9c,0xf7,0xf7,0x20,0xe8,0xe9,0x3d,0x04,0x5b,
+    0x9f,0x40,0xcb,0xa9,0x09,0xa8,0x77,0xfb,0x9f,0x32,0x07,0xf7,0x80,0x56,0xd6,0x48,
+    0xcd,0x6c,0xe0,0x52,0x45,0x01,0x2b,0x70,0x68,0x31,0x06,0x56,0x92,0x91,0x4d,0x1a,
+    0x27,0xab,0x3d,0xad,0xad,0xf0,0xb6,0x77,0x0b,0x28,0x1b,0x4b,0x62,0xf5,0xb1,0x77,
+    0x18,0x50,0xd0,0x2f,0x47,0x17,0xb0,0x54,0x41,0xf2,0xdc,0xb6,0x16,0xa3,0x92,0xcb,
+    0xd7,0xd4,0x47,0xa7,0xf3,0x99,0x35,0xa4,0xe2,0x9a,0xd6,0x68,0x97,0x34,0x90,0xdc,
+    0xaa,0xbd,0x2c,0x08,0x1b,0x70,0x40,0xfc,0xb2,0x22,0x02,0x72,0x57,0x48,0x48,0xdf,
+    0xe7,0x9c,0x44,0x0d,0x24,0xab,0xc6,0x75,0xef,0x72,0x89,0x6b,0xc6,0xdf,0xd3,0x5a,
+    0x0a,0x09,0x61,0x2b,0x68,0x34,0x7e,0xcb,0xce,0x90,0x80,0xea,0x2e,0x3f,0x81,0x1f,
+    0x22,0x62,0xa2,0x39,0x99,0x48,0x36,0xc6,0x27,0x38,0xf8,0x0d,0x49,0x1d,0xd9,0x42,
+    0x82,0x98,0xe3,0xd6,0xa3,0xcd,0x44,0x45,0x15,0x33,0x4e,0xc2,0xf8,0x63,0xac,0x28,
+    0x2f,0xe9,0xec,0xed,0x0b,0xd3,0x2c,0xe7,0x74,0xd0,0xe0,0x45,0xb6,0xae,0x36,0x5d,
+    0x36,0x95,0x52,0xd5,0x3e,0x2f,0xfb,0x13,0xb6,0xba,0x91,0x33,0xe4,0xd1,0xbc,0x37,
+    0xf4,0x2f,0x9e,0xfc,0x14,0x05,0x24,0x45,0x35,0x35,0x13,0x0a,0xc4,0xa2,0x66,0xe6,
+    0x69,0xcc,0x6c,0xdc,0x34,0x14,0x83,0xf8,0x82,0xa6,0xfe,0x7e,0x56,0x9c,0x94,0x06,
+    0xe3,0x1b,0xc9,0x00,0x35,0xd5,0x2b,0x7b,0x84,0xc2,0xc0,0x60,0x1d,0x79,0x0a,0xd5,
+    0x8e,0xc4,0xb6,0xbf,0x44,0x68,0x89,0x4f,0xdc,0xf4,0x97,0xd2,0xd4,0x05,0xa8,0x94,
+    0xc5,0x49,0xc7,0x4c,0x08,0x68,0x08,0xee,0xde,0x9c,0x3e,0xe6,0x42,0xd6,0x60,0x42,
+    0x6c,0xcc,0x92,0x2e,0x30,0xba,0xa8,0x68,0xf1,0x0c,0xd1,0x9b,0xfa,0x86,0xa1,0xd0,
+    0x9f,0xda,0xab,0x17,0xc4,0xa9,0xce,0xa9,0x7a,0x02,0x45,0xbd,0x9b,0x4e,0x4b,0xac,
+    0x1b,0x26,0xe2,0x30,0x82,0x0b,0xa7,0xa1,0x40,0xa7,0xa7,0xdb,0xbe,0x08,0xf0,0xc9,
+    0xc8,0x50,0x8f,0x06,0xec,0x8a,0xca,0xd6,0xee,0xd5,0x1c,0xbc,0x02,0xb2,0x8d,0x67,
+    0xc9,0x28,0x27,0xd9,0x47,0xc9,0x7b,0x65,0x0e,0x84,0x49,0x3c,0xb7,0xe0,0x6c,0xbb,
+    0x27,0xc4,0x85,0xd5,0xc6,0xaf,0x38,0xbb,0x74,0x81,0xd0,0x42,0x2a,0x6c,0xeb,0xfb,
+    0x5a,0x6e,0xb8,0xbc,0x73,0x76,0x43,0x42,0x0d,0xd1,0xb2,0x3d,0x4a,0x4b,0xce,0x08,
+    0xba,0x29,0x12,0xfb,0x1e,0x93,0x1b,0x6d,0x9a,0xb7,0x73,0x28,0x57,0x5b,0x28,0x79,
+    0x94,0xac,0x0e,0x1b,0xff,0xf7,0xce,0x76,0x00,0x4e,0x8f,0x54,0x90,0x6b,0x81,0xb7,
+    0x95,0x39,0x56,0xd2,0x58,0x1e,0x0e,0xfa,0xa1,0xe0,0xe6,0xad,0xd0,0x66,0x65,0xe4,
+    0x46,0x56,0x58,0xcf,0xff,0xa6,0x8a,0x60,0x81,0xa1,0xd0,0x85,0x06,0x47,0x15,0x2b,
+    0xc3,0x72,0xde,0x83,0x91,0x61,0x8b,0x5b,0xaf,0xf6,0x5d,0xb5,0x8e,0xaa,0x4d,0x54,
+    0x6d,0xa3,0x6a,0x17,0x55,0xfb,0xa8,0x3a,0x4c,0xe4,0x7d,0xfa,0x4e,0x8f,0x92,0xa2,
+    0x7f,0xfd,0xf3,0x53,0xf4,0x8b,0x62,0x98,0x07,0x82,0xe1,0x66,0xd0,0x3d,0xb7,0x07,
+    0xdb,0xa1,0x36,0x21,0xc5,0xf5,0xac,0x6d,0x40,0xd9,0xec,0x2c,0x65,0x17,0x52,0xdc,
+    0x99,0x7d,0x40,0x59,0xdf,0x5b,0xca,0x21,0xa4,0x38,0xc9,0xd7,0xad,0xec,0x01,0xd9,
+    0x25,0x63,0x24,0xd6,0x20,0x11,0x25,0x70,0x1e,0x61,0xb8,0x61,0x3f,0xb6,0xf6,0x63,
+    0x67,0x3f,0xf6,0xf6,0xe3,0x80,0xf0,0xe4,0x6e,0xdf,0xa6,0x6c,0x77,0x1d,0x1b,0xff,
+    0x18,0xa3,0x7e,0x44,0xd9,0xd6,0x1e,0xc4,0x9e,0x52,0x3a,0xa8,0xdb,0x78,0x75,0xb6,
+    0xbb,0x7b,0xca,0x30,0xce,0x62,0xc0,0xba,0xbb,0xe8,0x8b,0x9d,0xb1,0xcd,0x63,0x98,
+    0x7b,0xc0,0xe2,0xb8,0xd1,0x34,0x1d,0xbe,0x0c,0xda,0x6c,0x17,0x76,0x89,0x91,0xbd,
+    0x32,0x62,0x2a,0xbf,0xba,0x0c,0x73,0xda,0x89,0xf0,0x82,0x22,0x53,0x45,0x66,0x4c,
+    0x28,0x97,0xb0,0xab,0xd7,0x6d,0xec,0x7f,0x53,0x82,0x8c,0xba,0x32,0x62,0x7b,0x17,
+    0x08,0x21,0xee,0x30,0x0c,0x5a,0xd6,0xd8,0xb3,0x36,0x93,0xe0,0x46,0x2a,0x0c,0x94,
+    0x52,0xc5,0x38,0xf9,0x4c,0x5f,0xa8,0xb8,0x6d,0x67,0x83,0xfe,0xa6,0x5c,0xdb,0xb7,
+    0xbb,0xed,0xcc,0x40,0x86,0x44,0xc1,0x8f,0x6a,0x6c,0x50,0x10,0x37,0x04,0xd1,0x9c,
+    0x9a,0x1e,0x43,0x91,0xf2,0xcc,0x35,0x79,0x3f,0x43,0x39,0x2d,0xcd,0xe5,0x5c,0x05,
+    0xbc,0x43,0xf9,0x55,0x5a,0x32,0xa5,0x8d,0xb7,0x2b,0xd4,0x45,0x42,0xc6,0xa0,0x37,
+    0xb6,0x12,0x7d,0xd6,0xd8,0xa3,0xb0,0x80,0xe5,0x58,0xb5,0x9c,0xe9,0x7e,0x6b,0x88,
+    0x6d,0x57,0xf0,0x7b,0xd1,0x50,0xbd,0xe7,0x5a,0xcc,0x2e,0x67,0xf1,0x59,0x04,0xac,
+    0xad,0x2d,0x70,0xb0,0x71,0x26,0x4f,0x19,0x90,0x53,0x93,0xa5,0x6e,0x14,0x08,0xfe,
+    0xa3,0x0b,0x53,0xdc,0xf1,0x7e,0x31,0x3a,0x2f,0x29,0xf3,0x8d,0xea,0xa6,0x28,0x8a,
+    0xf0,0x1a,0xf6,0xa3,0xf1,0xdc,0xb6,0x9c,0x0f,0xe8,0xcf,0xac,0x6e,0xa4,0x32,0x58,
+    0x98,0xe9,0xe1,0x71,0x93,0xb3,0xa3,0xd4,0xaf,0x31,0xb0,0x05,0x41,0x33,0xda,0x6a,
+    0x44,0x61,0x6f,0xc9,0x96,0x18,0x4e,0x4c,0xc1,0xa5,0xa6,0xb9,0x11,0x57,0x75,0x66,
+    0x1e,0x06,0x65,0xab,0x25,0x9b,0x96,0x77,0x76,0xd9,0xa7,0xb2,0x69,0x05,0x84,0xb2,
+    0x3d,0x06,0xd1,0x84,0xe4,0x46,0x64,0x08,0xcb,0x55,0xfd,0x17,0x13,0xdb,0x4a,0x70,
+    0x0d,0xbf,0x0d,0x60,0xcf,0xa6,0x01,0x09,0xaa,0x24,0x5b,0xac,0x8a,0xfb,0xc4,0xbe,
+    0x83,0xb2,0x73,0xa2,0x39,0xce,0x29,0x3f,0xdb,0xf4,0x70,0xb8,0xbf,0xf7,0x7e,0x80,
+    0xab,0xb0,0xe7,0x83,0x54,0x5c,0x9a,0xde,0x11,0x25,0x5f,0xe3,0xc1,0x08,0x47,0x6d,
+    0xfb,0x31,0x96,0x7e,0xfa,0x34,0x2d,0x84,0x0c,0x1e,0x2e,0xb0,0x02,0x8c,0x4c,0xd5,
+    0x4b,0xe3,0x3e,0xb5,0x2b,0xa6,0x48,0x90,0x68,0x97,0xd6,0xc0,0xb9,0x95,0x5e,0xb7,
+    0x9e,0x7a,0xbf,0xda,0xda,0x57,0xc0,0xd9,0xf4,0x9c,0xf5,0x61,0x75,0xb0,0xaf,0x80,
+    0xb5,0xed,0x59,0x9b,0xdd,0xea,0xc1,0xbe,0x02,0xd6,0xae,0x67,0x6d,0xb7,0x33,0x81,
+    0xfb,0x9e,0xb5,0x5b,0xcf,0x04,0x1e,0x06,0xd6,0xc3,0x4c,0xe0,0x5d,0xcf,0xda,0xcf,
+    0x2d,0xbc,0xef,0x59,0x87,0xb9,0x85,0x0f,0x3d,0xeb,0x6e,0x6e,0xe1,0x3a,0x19,0x5c,
+    0x9e,0x9b,0xb8,0x1e,0xe0,0x78,0x98,0xdb,0xb8,0xde,0x04,0xa8,0xf6,0xa7,0x46,0x73,
+    0xff,0x56,0x53,0xc2,0x30,0x92,0x82,0xbf,0x23,0x5d,0x28,0x4a,0x85,0x7b,0x82,0xfd,
+    0x5c,0x43,0x1f,0xef,0x8d,0x4c,0x20,0x3d,0x6e,0xdb,0x41,0x5c,0xbd,0x08,0x7c,0xbd,
+    0x0c,0x7c,0xbd,0x0c,0x7c,0xbd,0x9b,0x59,0x37,0x0f,0x41,0xbd,0x1c,0x82,0x7a,0x39,
+    0x04,0xf5,0x72,0x08,0xea,0xe5,0x10,0xd4,0xcb,0x21,0xa8,0x3f,0x08,0x41,0xfd,0x41,
+    0x08,0xea,0xf5,0x66,0x06,0xfc,0x0f,0x20,0xff,0xf0,0xb0,0x0d,0x91,0xe7,0x8b,0xc8,
+    0xf3,0x65,0xe4,0xf9,0x32,0xf2,0xfc,0x47,0x90,0xe7,0xcb,0xc8,0xf3,0x65,0xe4,0xf9,
+    0x32,0xf2,0x7c,0x19,0x79,0xbe,0x8c,0x3c,0xff,0x00,0x79,0xfe,0x01,0xf2,0xfc,0x03,
+    0xe4,0x27,0xa0,0xe3,0xb7,0x79,0xba,0x5f,0x0e,0x3d,0xb7,0x5f,0xfc,0x9f,0xb7,0xdb,
+    0x60,0xce,0x17,0xd4,0xf5,0x6a,0x67,0xdc,0x30,0xa9,0x0f,0xbb,0x71,0x68,0xdb,0x15,
+    0xeb,0x00,0x03,0x24,0x98,0x67,0xc3,0x10,0x1d,0x1a,0xf5,0x05,0xbb,0xbb,0xe8,0xb7,
+    0x97,0xfd,0xf7,0xaf,0x63,0x7c,0xaf,0x72,0x00,0xa0,0xf3,0xa3,0x94,0xdd,0x53,0xa6,
+    0x3d,0xfd,0xcc,0x5b,0x25,0xf6,0x09,0x7c,0x1c,0xe2,0xfd,0x3f,0x73,0x86,0x75,0xcf,
+    0xad,0x86,0xc0,0xcb,0xa6,0xeb,0xdf,0x78,0xbc,0xc0,0x8a,0xc4,0x3b,0xff,0xbc,0x54,
+    0x61,0x02,0x8b,0x45,0x82,0x76,0x7e,0x31,0x42,0x09,0x52,0xc7,0x1c,0x7f,0x4e,0x22,
+    0xf7,0x5e,0x6d,0x6e,0xa3,0x04,0xd9,0xa5,0xc9,0x2f,0x95,0x53,0xe6,0xfa,0xe1,0xf6,
+    0xd2,0x77,0xff,0xbf,0x99,0x9c,0x9f,0x68,0x30,0x30,0x43,0xfc,0xe6,0x2b,0xc5,0xfd,
+    0xdd,0xd7,0x6f,0xdf,0x7e,0xbd,0x14,0x74,0xb4,0xc1,0x1c,0x64,0x94,0x65,0xf9,0xb1,
+    0x8c,0xdd,0xd7,0x5f,0xfe,0xb1,0x4f,0x2e,0x65,0x18,0x8a,0xf9,0x0f,0x8b,0xf0,0x43,
+    0xf4,0x52,0xc4,0x6b,0xc5,0xcc,0x8f,0xbb,0x32,0x55,0xd2,0xfd,0x0f,0xc6,0x55,0x2c,
+    0x26,0x94,0x14,0x00,0x00,
+};
+
+// /index.tmpl, 1508 bytes
+static const uint8_t bundle_index_tmpl[] PROGMEM={
+    0x3c,0x68,0x74,0x6d,0x6c,0x3e,0x3c,0x68,0x65,0x61,0x64,0x3e,0x3c,0x74,0x69,0x74,
+    0x6c,0x65,0x3e,0x4c,0x48,0x57,0x65,0x62,0x3c,0x2f,0x74,0x69,0x74,0x6c,0x65,0x3e,
+    0x3c,0x6d,0x65,0x74,0x61,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x65,0x77,
+    0x70,0x6f,0x72,0x74,0x22,0x20,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x3d,0x22,0x77,
+    0x69,0x64,0x74,0x68,0x3d,0x64,0x65,0x76,0x69,0x63,0x65,0x2d,0x77,0x69,0x64,0x74,
+    0x68,0x2c,0x20,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x2d,0x73,0x63,0x61,0x6c,0x65,
+    0x3d,0x31,0x22,0x3e,0x3c,0x6c,0x69,0x6e,0x6b,0x20,0x72,0x65,0x6c,0x3d,0x22,0x73,
+    0x74,0x79,0x6c,0x65,0x73,0x68,0x65,0x65,0x74,0x22,0x20,0x68,0x72,0x65,0x66,0x3d,
+    0x22,0x77,0x33,0x2e,0x63,0x73,0x73,0x22,0x3e,0x3c,0x73,0x74,0x79,0x6c,0x65,0x3e,
+    0x3c,0x2f,0x73,0x74,0x79,0x6c,0x65,0x3e,0x3c,0x2f,0x68,0x65,0x61,0x64,0x3e,0x3c,
+    0x62,0x6f,0x64,0x79,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
+    0x22,0x77,0x33,0x2d,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x20,0x77,0x33,
+    0x2d,0x74,0x65,0x61,0x6c,0x22,0x3e,0x3c,0x68,0x31,0x3e,0x4c,0x48,0x57,0x65,0x62,
+    0x3c,0x2f,0x68,0x31,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x75,0x6c,0x20,0x63,
+    0x6c,0x61,0x73,0x73,0x3d,0x22,0x77,0x33,0x2d,0x6e,0x61,0x76,0x62,0x61,0x72,0x20,
+    0x77,0x33,0x2d,0x6c,0x69,0x67,0x68,0x74,0x2d,0x62,0x6c,0x75,0x65,0x22,0x3e,0x3c,
+    0x6c,0x69,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x77,0x33,0x2d,0x77,0x68,0x69,
+    0x74,0x65,0x22,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x2f,0x22,0x3e,
+    0x48,0x6f,0x6d,0x65,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x3c,0x6c,0x69,
+    0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x2f,0x77,0x65,0x62,0x63,0x6f,
+    0x6e,0x66,0x69,0x67,0x22,0x3e,0x57,0x65,0x62,0x20,0x43,0x6f,0x6e,0x66,0x69,0x67,
+    0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x3c,0x6c,0x69,0x3e,0x3c,0x61,0x20,
+    0x68,0x72,0x65,0x66,0x3d,0x22,0x2f,0x75,0x73,0x65,0x72,0x63,0x6f,0x6e,0x66,0x69,
+    0x67,0x22,0x3e,0x55,0x73,0x65,0x72,0x20,0x43,0x6f,0x6e,0x66,0x69,0x67,0x3c,0x2f,
+    0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x3c,0x6c,0x69,0x3e,0x3c,0x61,0x20,0x68,0x72,
+    0x65,0x66,0x3d,0x22,0x2f,0x62,0x72,0x6f,0x77,0x73,0x65,0x22,0x3e,0x46,0x69,0x6c,
+    0x65,0x20,0x42,0x72,0x6f,0x77,0x73,0x65,0x72,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,
+    0x69,0x3e,0x3c,0x6c,0x69,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x2f,
+    0x73,0x68,0x6f,0x77,0x6c,0x6f,0x67,0x22,0x3e,0x4c,0x6f,0x67,0x3c,0x2f,0x61,0x3e,
+    0x3c,0x2f,0x6c,0x69,0x3e,0x3c,0x6c,0x69,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,
+    0x3d,0x22,0x2f,0x64,0x6f,0x63,0x75,0x2e,0x68,0x74,0x6d,0x6c,0x22,0x3e,0x44,0x6f,
+    0x63,0x75,0x6d,0x65,0x6e,0x74,0x61,0x74,0x69,0x6f,0x6e,0x3c,0x2f,0x61,0x3e,0x3c,
+    0x2f,0x6c,0x69,0x3e,0x3c,0x2f,0x75,0x6c,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,
+    0x61,0x73,0x73,0x3d,0x22,0x77,0x33,0x2d,0x72,0x6f,0x77,0x2d,0x70,0x61,0x64,0x64,
+    0x69,0x6e,0x67,0x20,0x77,0x33,0x2d,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x2d,0x36,
+    0x34,0x20,0x77,0x33,0x2d,0x74,0x68,0x65,0x6d,0x65,0x2d,0x6c,0x31,0x22,0x3e,0x3c,
+    0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x77,0x33,0x2d,0x74,0x68,
+    0x69,0x72,0x64,0x22,0x3e,0x3c,0x74,0x61,0x62,0x6c,0x65,0x20,0x63,0x6c,0x61,0x73,
+    0x73,0x3d,0x22,0x77,0x33,0x2d,0x74,0x61,0x62,0x6c,0x65,0x20,0x77,0x33,0x2d,0x62,
+    0x6f,0x72,0x64,0x65,0x72,0x65,0x64,0x20,0x77,0x33,0x2d,0x73,0x74,0x72,0x69,0x70,
+    0x65,0x64,0x20,0x77,0x33,0x2d,0x63,0x61,0x72,0x64,0x2d,0x34,0x22,0x3e,0x3c,0x74,
+    0x72,0x3e,0x3c,0x74,0x64,0x20,0x63,0x6f,0x6c,0x73,0x70,0x61,0x6e,0x3d,0x22,0x32,
+    0x22,0x3e,0x3c,0x68,0x32,0x3e,0x57,0x4c,0x41,0x4e,0x20,0x49,0x6e,0x66,0x6f,0x3c,
+    0x2f,0x68,0x32,0x3e,0x3c,0x2f,0x74,0x64,0x3e,0x3c,0x2f,0x74,0x72,0x3e,0x3c,0x74,
+    0x72,0x3e,0x3c,0x74,0x64,0x3e,0x53,0x53,0x49,0x44,0x3c,0x2f,0x74,0x64,0x3e,0x3c,
+    0x74,0x64,0x3e,0x7b,0x7b,0x20,0x73,0x73,0x69,0x64,0x20,0x7d,0x7d,0x3c,0x2f,0x74,
+    0x64,0x3e,0x3c,0x2f,0x74,0x72,0x3e,0x3c,0x74,0x72,0x3e,0x3c,0x74,0x64,0x3e,0x41,
+    0x50,0x3c,0x2f,0x74,0x64,0x3e,0x3c,0x74,0x64,0x3e,0x7b,0x7b,0x20,0x62,0x73,0x73,
+    0x69,0x64,0x20,0x7d,0x7d,0x3c,0x2f,0x74,0x64,0x3e,0x3c,0x2f,0x74,0x72,0x3e,0x3c,
+    0x74,0x72,0x3e,0x3c,0x74,0x64,0x3e,0x52,0x53,0x53,0x49,0x3c,0x2f,0x74,0x64,0x3e,
+    0x3c,0x74,0x64,0x3e,0x7b,0x7b,0x20,0x72,0x73,0x73,0x69,0x20,0x7d,0x7d,0x3c,0x2f,
+    0x74,0x64,0x3e,0x3c,0x2f,0x74,0x72,0x3e,0x3c,0x74,0x72,0x3e,0x3c,0x74,0x64,0x3e,
+    0x4d,0x41,0x43,0x3c,0x2f,0x74,0x64,0x3e,0x3c,0x74,0x64,0x3e,0x7b,0x7b,0x20,0x6d,
+    0x61,0x63,0x20,0x7d,0x7d,0x3c,0x2f,0x74,0x64,0x3e,0x3c,0x2f,0x74,0x72,0x3e,0x3c,
+    0x2f,0x74,0x61,0x62,0x6c,0x65,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,
+    0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x77,0x33,0x2d,0x74,0x68,0x69,0x72,
+    0x64,0x22,0x3e,0x3c,0x74,0x61,0x62,0x6c,0x65,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
+    0x22,0x77,0x33,0x2d,0x74,0x61,0x62,0x6c,0x65,0x20,0x77,0x33,0x2d,0x62,0x6f,0x72,
+    0x64,0x65,0x72,0x65,0x64,0x20,0x77,0x33,0x2d,0x73,0x74,0x72,0x69,0x70,0x65,0x64,
+    0x20,0x77,0x33,0x2d,0x63,0x61,0x72,0x64,0x2d,0x34,0x22,0x3e,0x3c,0x74,0x72,0x3e,
+    0x3c,0x74,0x64,0x20,0x63,0x6f,0x6c,0x73,0x70,0x61,0x6e,0x3d,0x22,0x32,0x22,0x3e,
+    0x3c,0x68,0x32,0x3e,0x4e,0x65,0x74,0x7a,0x77,0x65,0x72,0x6b,0x20,0x49,0x6e,0x66,
+    0x6f,0x3c,0x2f,0x68,0x32,0x3e,0x3c,0x2f,0x74,0x64,0x3e,0x3c,0x2f,0x74,0x72,0x3e,
+    0x3c,0x74,0x72,0x3e,0x3c,0x74,0x64,0x3e,0x49,0x50,0x2d,0x41,0x64,0x72,0x65,0x73,
+    0x73,0x65,0x3c,0x2f,0x74,0x64,0x3e,0x3c,0x74,0x64,0x3e,0x7b,0x7b,0x20,0x69,0x70,
+    0x20,0x7d,0x7d,0x3c,0x2f,0x74,0x64,0x3e,0x3c,0x2f,0x74,0x72,0x3e,0x3c,0x74,0x72,
+    0x3e,0x3c,0x74,0x64,0x3e,0x4e,0x65,0x74,0x7a,0x6d,0x61,0x73,0x6b,0x65,0x3c,0x2f,
+    0x74,0x64,0x3e,0x3c,0x74,0x64,0x3e,0x7b,0x7b,0x20,0x6d,0x61,0x73,0x6b,0x20,0x7d,
+    0x7d,0x3c,0x2f,0x74,0x64,0x3e,0x3c,0x2f,0x74,0x72,0x3e,0x3c,0x74,0x72,0x3e,0x3c,
+    0x74,0x64,0x3e,0x47,0x61,0x74,0x65,0x77,0x61,0x79,0x3c,0x2f,0x74,0x64,0x3e,0x3c,
+    0x74,0x64,0x3e,0x7b,0x7b,0x20,0x67,0x77,0x20,0x7d,0x7d,0x3c,0x2f,0x74,0x64,0x3e,
+    0x3c,0x2f,0x74,0x72,0x3e,0x3c,0x74,0x72,0x3e,0x3c,0x74,0x64,0x3e,0x44,0x4e,0x53,
+    0x3c,0x2f,0x74,0x64,0x3e,0x3c,0x74,0x64,0x3e,0x7b,0x7b,0x20,0x64,0x6e,0x73,0x20,
+    0x7d,0x7d,0x3c,0x2f,0x74,0x64,0x3e,0x3c,0x2f,0x74,0x72,0x3e,0x3c,0x74,0x72,0x3e,
+    0x3c,0x74,0x64,0x3e,0x48,0x6f,0x73,0x74,0x6e,0x61,0x6d,0x65,0x3c,0x2f,0x74,0x64,
+    0x3e,0x3c,0x74,0x64,0x3e,0x7b,0x7b,0x20,0x68,0x6f,0x73,0x74,0x6e,0x61,0x6d,0x65,
+    0x20,0x7d,0x7d,0x3c,0x2f,0x74,0x64,0x3e,0x3c,0x2f,0x74,0x72,0x3e,0x3c,0x2f,0x74,
+    0x61,0x62,0x6c,0x65,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,
+    0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x77,0x33,0x2d,0x74,0x68,0x69,0x72,0x64,0x22,
+    0x3e,0x3c,0x74,0x61,0x62,0x6c,0x65,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x77,
+    0x33,0x2d,0x74,0x61,0x62,0x6c,0x65,0x20,0x77,0x33,0x2d,0x62,0x6f,0x72,0x64,0x65,
+    0x72,0x65,0x64,0x20,0x77,0x33,0x2d,0x73,0x74,0x72,0x69,0x70,0x65,0x64,0x20,0x77,
+    0x33,0x2d,0x63,0x61,0x72,0x64,0x2d,0x34,0x22,0x3e,0x3c,0x74,0x72,0x3e,0x3c,0x74,
+    0x64,0x20,0x63,0x6f,0x6c,0x73,0x70,0x61,0x6e,0x3d,0x22,0x32,0x22,0x3e,0x3c,0x68,
+    0x32,0x3e,0x48,0x61,0x72,0x64,0x77,0x61,0x72,0x65,0x3c,0x2f,0x68,0x32,0x3e,0x3c,
+    0x2f,0x74,0x64,0x3e,0x3c,0x2f,0x74,0x72,0x3e,0x3c,0x74,0x72,0x3e,0x3c,0x74,0x64,
+    0x3e,0x46,0x6c,0x61,0x73,0x68,0x20,0x53,0x70,0x65,0x69,0x63,0x68,0x65,0x72,0x3c,
+    0x2f,0x74,0x64,0x3e,0x3c,0x74,0x64,0x3e,0x7b,0x7b,0x20,0x66,0x6c,0x61,0x73,0x68,
+    0x5f,0x6d,0x65,0x6d,0x20,0x7d,0x7d,0x3c,0x2f,0x74,0x64,0x3e,0x3c,0x2f,0x74,0x72,
+    0x3e,0x3c,0x74,0x72,0x3e,0x3c,0x74,0x64,0x3e,0x42,0x6f,0x61,0x72,0x64,0x20,0x49,
+    0x44,0x3c,0x2f,0x74,0x64,0x3e,0x3c,0x74,0x64,0x3e,0x7b,0x7b,0x20,0x62,0x6f,0x61,
+    0x72,0x64,0x5f,0x69,0x64,0x20,0x7d,0x7d,0x3c,0x2f,0x74,0x64,0x3e,0x3c,0x2f,0x74,
+    0x72,0x3e,0x3c,0x2f,0x74,0x61,0x62,0x6c,0x65,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,
+    0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x2f,0x62,0x6f,0x64,0x79,0x3e,0x3c,0x2f,0x68,
+    0x74,0x6d,0x6c,0x3e,
+};
+
+// /webconfig.tmpl, 1136 bytes
+static const uint8_t bundle_webconfig_tmpl[] PROGMEM={
+    0x3c,0x68,0x74,0x6d,0x6c,0x3e,0x3c,0x68,0x65,0x61,0x64,0x3e,0x3c,0x74,0x69,0x74,
+    0x6c,0x65,0x3e,0x4c,0x48,0x57,0x65,0x62,0x3c,0x2f,0x74,0x69,0x74,0x6c,0x65,0x3e,
+    0x3c,0x6d,0x65,0x74,0x61,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x65,0x77,
+    0x70,0x6f,0x72,0x74,0x22,0x20,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x3d,0x22,0x77,
+    0x69,0x64,0x74,0x68,0x3d,0x64,0x65,0x76,0x69,0x63,0x65,0x2d,0x77,0x69,0x64,0x74,
+    0x68,0x2c,0x20,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x2d,0x73,0x63,0x61,0x6c,0x65,
+    0x3d,0x31,0x22,0x3e,0x3c,0x6c,0x69,0x6e,0x6b,0x20,0x72,0x65,0x6c,0x3d,0x22,0x73,
+    0x74,0x79,0x6c,0x65,0x73,0x68,0x65,0x65,0x74,0x22,0x20,0x68,0x72,0x65,0x66,0x3d,
+    0x22,0x77,0x33,0x2e,0x63,0x73,0x73,0x22,0x3e,0x3c,0x73,0x74,0x79,0x6c,0x65,0x3e,
+    0x3c,0x2f,0x73,0x74,0x79,0x6c,0x65,0x3e,0x3c,0x2f,0x68,0x65,0x61,0x64,0x3e,0x3c,
+    0x62,0x6f,0x64,0x79,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
+    0x22,0x77,0x33,0x2d,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x20,0x77,0x33,
+    0x2d,0x74,0x65,0x61,0x6c,0x22,0x3e,0x3c,0x68,0x31,0x3e,0x4c,0x48,0x57,0x65,0x62,
+    0x3c,0x2f,0x68,0x31,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x75,0x6c,0x20,0x63,
+    0x6c,0x61,0x73,0x73,0x3d,0x22,0x77,0x33,0x2d,0x6e,0x61,0x76,0x62,0x61,0x72,0x20,
+    0x77,0x33,0x2d,0x6c,0x69,0x67,0x68,0x74,0x2d,0x62,0x6c,0x75,0x65,0x22,0x3e,0x3c,
+    0x6c,0x69,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x2f,0x22,0x3e,0x48,
+    0x6f,0x6d,0x65,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x3c,0x6c,0x69,0x20,
+    0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x77,0x33,0x2d,0x77,0x68,0x69,0x74,0x65,0x22,
+    0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x2f,0x77,0x65,0x62,0x63,0x6f,
+    0x6e,0x66,0x69,0x67,0x22,0x3e,0x57,0x65,0x62,0x20,0x43,0x6f,0x6e,0x66,0x69,0x67,
+    0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x3c,0x6c,0x69,0x3e,0x3c,0x61,0x20,
+    0x68,0x72,0x65,0x66,0x3d,0x22,0x2f,0x75,0x73,0x65,0x72,0x63,0x6f,0x6e,0x66,0x69,
+    0x67,0x22,0x3e,0x55,0x73,0x65,0x72,0x20,0x43,0x6f,0x6e,0x66,0x69,0x67,0x3c,0x2f,
+    0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x3c,0x6c,0x69,0x3e,0x3c,0x61,0x20,0x68,0x72,
+    0x65,0x66,0x3d,0x22,0x2f,0x62,0x72,0x6f,0x77,0x73,0x65,0x22,0x3e,0x46,0x69,0x6c,
+    0x65,0x20,0x42,0x72,0x6f,0x77,0x73,0x65,0x72,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,
+    0x69,0x3e,0x3c,0x6c,0x69,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x2f,
+    0x73,0x68,0x6f,0x77,0x6c,0x6f,0x67,0x22,0x3e,0x4c,0x6f,0x67,0x3c,0x2f,0x61,0x3e,
+    0x3c,0x2f,0x6c,0x69,0x3e,0x3c,0x6c,0x69,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,
+    0x3d,0x22,0x2f,0x64,0x6f,0x63,0x75,0x2e,0x68,0x74,0x6d,0x6c,0x22,0x3e,0x44,0x6f,
+    0x63,0x75,0x6d,0x65,0x6e,0x74,0x61,0x74,0x69,0x6f,0x6e,0x3c,0x2f,0x61,0x3e,0x3c,
+    0x2f,0x6c,0x69,0x3e,0x3c,0x2f,0x75,0x6c,0x3e,0x20,0x7b,0x7b,0x62,0x61,0x6e,0x6e,
+    0x65,0x72,0x7d,0x7d,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
+    0x22,0x77,0x33,0x2d,0x72,0x6f,0x77,0x2d,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x20,
+    0x77,0x33,0x2d,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x2d,0x36,0x34,0x20,0x77,0x33,
+    0x2d,0x74,0x68,0x65,0x6d,0x65,0x2d,0x6c,0x31,0x22,0x3e,0x3c,0x64,0x69,0x76,0x20,
+    0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x77,0x33,0x2d,0x63,0x61,0x72,0x64,0x2d,0x34,
+    0x22,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x77,0x33,
+    0x2d,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x20,0x77,0x33,0x2d,0x74,0x68,
+    0x65,0x6d,0x65,0x2d,0x6c,0x31,0x22,0x3e,0x3c,0x68,0x32,0x3e,0x57,0x4c,0x41,0x4e,
+    0x20,0x63,0x6f,0x6e,0x66,0x69,0x67,0x3c,0x2f,0x68,0x32,0x3e,0x3c,0x2f,0x64,0x69,
+    0x76,0x3e,0x3c,0x66,0x6f,0x72,0x6d,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x77,
+    0x33,0x2d,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x22,0x20,0x6d,0x65,0x74,
+    0x68,0x6f,0x64,0x3d,0x22,0x70,0x6f,0x73,0x74,0x22,0x3e,0x3c,0x70,0x3e,0x3c,0x69,
+    0x6e,0x70,0x75,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x77,0x33,0x2d,0x69,
+    0x6e,0x70,0x75,0x74,0x22,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x74,0x65,0x78,0x74,
+    0x22,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x77,0x69,0x66,0x69,0x5f,0x73,0x73,0x69,
+    0x64,0x22,0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,0x22,0x7b,0x7b,0x73,0x73,0x69,0x64,
+    0x7d,0x7d,0x22,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,
+    0x3d,0x22,0x77,0x33,0x2d,0x6c,0x61,0x62,0x65,0x6c,0x22,0x3e,0x53,0x53,0x49,0x44,
+    0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x2f,0x70,0x3e,0x3c,0x70,0x3e,0x3c,
+    0x69,0x6e,0x70,0x75,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x77,0x33,0x2d,
+    0x69,0x6e,0x70,0x75,0x74,0x22,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x74,0x65,0x78,
+    0x74,0x22,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x77,0x69,0x66,0x69,0x5f,0x70,0x61,
+    0x73,0x73,0x22,0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,0x22,0x7b,0x7b,0x70,0x61,0x73,
+    0x73,0x7d,0x7d,0x22,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,
+    0x73,0x3d,0x22,0x77,0x33,0x2d,0x6c,0x61,0x62,0x65,0x6c,0x22,0x3e,0x50,0x61,0x73,
+    0x73,0x77,0x6f,0x72,0x74,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x2f,0x70,
+    0x3e,0x3c,0x70,0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,
+    0x3d,0x22,0x77,0x33,0x2d,0x69,0x6e,0x70,0x75,0x74,0x22,0x20,0x74,0x79,0x70,0x65,
+    0x3d,0x22,0x74,0x65,0x78,0x74,0x22,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x77,0x69,
+    0x66,0x69,0x5f,0x68,0x6f,0x73,0x74,0x22,0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,0x22,
+    0x7b,0x7b,0x68,0x6f,0x73,0x74,0x7d,0x7d,0x22,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,
+    0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x77,0x33,0x2d,0x6c,0x61,0x62,0x65,0x6c,
+    0x22,0x3e,0x48,0x6f,0x73,0x74,0x6e,0x61,0x6d,0x65,0x3c,0x2f,0x6c,0x61,0x62,0x65,
+    0x6c,0x3e,0x3c,0x2f,0x70,0x3e,0x3c,0x70,0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,
+    0x74,0x79,0x70,0x65,0x3d,0x22,0x73,0x75,0x62,0x6d,0x69,0x74,0x22,0x20,0x76,0x61,
+    0x6c,0x75,0x65,0x3d,0x22,0x53,0x61,0x76,0x65,0x22,0x3e,0x3c,0x2f,0x70,0x3e,0x3c,
+    0x2f,0x66,0x6f,0x72,0x6d,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x2f,0x64,0x69,
+    0x76,0x3e,0x3c,0x2f,0x62,0x6f,0x64,0x79,0x3e,0x3c,0x2f,0x68,0x74,0x6d,0x6c,0x3e,
+};
+
+// /browse.tmpl, 889 bytes
+static const uint8_t bundle_browse_tmpl[] PROGMEM={
+    0x3c,0x68,0x74,0x6d,0x6c,0x3e,0x3c,0x68,0x65,0x61,0x64,0x3e,0x3c,0x74,0x69,0x74,
+    0x6c,0x65,0x3e,0x4c,0x48,0x57,0x65,0x62,0x3c,0x2f,0x74,0x69,0x74,0x6c,0x65,0x3e,
+    0x3c,0x6d,0x65,0x74,0x61,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x65,0x77,
+    0x70,0x6f,0x72,0x74,0x22,0x20,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x3d,0x22,0x77,
+    0x69,0x64,0x74,0x68,0x3d,0x64,0x65,0x76,0x69,0x63,0x65,0x2d,0x77,0x69,0x64,0x74,
+    0x68,0x2c,0x20,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x2d,0x73,0x63,0x61,0x6c,0x65,
+    0x3d,0x31,0x22,0x3e,0x3c,0x6c,0x69,0x6e,0x6b,0x20,0x72,0x65,0x6c,0x3d,0x22,0x73,
+    0x74,0x79,0x6c,0x65,0x73,0x68,0x65,0x65,0x74,0x22,0x20,0x68,0x72,0x65,0x66,0x3d,
+    0x22,0x77,0x33,0x2e,0x63,0x73,0x73,0x22,0x3e,0x3c,0x73,0x74,0x79,0x6c,0x65,0x3e,
+    0x3c,0x2f,0x73,0x74,0x79,0x6c,0x65,0x3e,0x3c,0x2f,0x68,0x65,0x61,0x64,0x3e,0x3c,
+    0x62,0x6f,0x64,0x79,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
+    0x22,0x77,0x33,0x2d,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x20,0x77,0x33,
+    0x2d,0x74,0x65,0x61,0x6c,0x22,0x3e,0x3c,0x68,0x31,0x3e,0x4c,0x48,0x57,0x65,0x62,
+    0x3c,0x2f,0x68,0x31,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x75,0x6c,0x20,0x63,
+    0x6c,0x61,0x73,0x73,0x3d,0x22,0x77,0x33,0x2d,0x6e,0x61,0x76,0x62,0x61,0x72,0x20,
+    0x77,0x33,0x2d,0x6c,0x69,0x67,0x68,0x74,0x2d,0x62,0x6c,0x75,0x65,0x22,0x3e,0x3c,
+    0x6c,0x69,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x2f,0x22,0x3e,0x48,
+    0x6f,0x6d,0x65,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x3c,0x6c,0x69,0x3e,
+    0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x2f,0x77,0x65,0x62,0x63,0x6f,0x6e,
+    0x66,0x69,0x67,0x22,0x3e,0x57,0x65,0x62,0x20,0x43,0x6f,0x6e,0x66,0x69,0x67,0x3c,
+    0x2f,0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x3c,0x6c,0x69,0x3e,0x3c,0x61,0x20,0x68,
+    0x72,0x65,0x66,0x3d,0x22,0x2f,0x75,0x73,0x65,0x72,0x63,0x6f,0x6e,0x66,0x69,0x67,
+    0x22,0x3e,0x55,0x73,0x65,0x72,0x20,0x43,0x6f,0x6e,0x66,0x69,0x67,0x3c,0x2f,0x61,
+    0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x3c,0x6c,0x69,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
+    0x22,0x77,0x33,0x2d,0x77,0x68,0x69,0x74,0x65,0x22,0x3e,0x3c,0x61,0x20,0x68,0x72,
+    0x65,0x66,0x3d,0x22,0x2f,0x62,0x72,0x6f,0x77,0x73,0x65,0x22,0x3e,0x46,0x69,0x6c,
+    0x65,0x20,0x42,0x72,0x6f,0x77,0x73,0x65,0x72,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,
+    0x69,0x3e,0x3c,0x6c,0x69,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x2f,
+    0x73,0x68,0x6f,0x77,0x6c,0x6f,0x67,0x22,0x3e,0x4c,0x6f,0x67,0x3c,0x2f,0x61,0x3e,
+    0x3c,0x2f,0x6c,0x69,0x3e,0x3c,0x6c,0x69,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,
+    0x3d,0x22,0x2f,0x64,0x6f,0x63,0x75,0x2e,0x68,0x74,0x6d,0x6c,0x22,0x3e,0x44,0x6f,
+    0x63,0x75,0x6d,0x65,0x6e,0x74,0x61,0x74,0x69,0x6f,0x6e,0x3c,0x2f,0x61,0x3e,0x3c,
+    0x2f,0x6c,0x69,0x3e,0x3c,0x2f,0x75,0x6c,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,
+    0x61,0x73,0x73,0x3d,0x22,0x77,0x33,0x2d,0x72,0x6f,0x77,0x2d,0x70,0x61,0x64,0x64,
+    0x69,0x6e,0x67,0x20,0x77,0x33,0x2d,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x2d,0x36,
+    0x34,0x20,0x77,0x33,0x2d,0x74,0x68,0x65,0x6d,0x65,0x2d,0x6c,0x31,0x22,0x3e,0x3c,
+    0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x77,0x33,0x2d,0x63,0x6f,
+    0x6c,0x2e,0x6d,0x31,0x30,0x22,0x3e,0x3c,0x74,0x61,0x62,0x6c,0x65,0x20,0x63,0x6c,
+    0x61,0x73,0x73,0x3d,0x22,0x77,0x33,0x2d,0x74,0x61,0x62,0x6c,0x65,0x20,0x77,0x33,
+    0x2d,0x62,0x6f,0x72,0x64,0x65,0x72,0x65,0x64,0x20,0x77,0x33,0x2d,0x73,0x74,0x72,
+    0x69,0x70,0x65,0x64,0x20,0x77,0x33,0x2d,0x63,0x61,0x72,0x64,0x2d,0x34,0x22,0x3e,
+    0x3c,0x74,0x72,0x3e,0x3c,0x74,0x64,0x20,0x63,0x6f,0x6c,0x73,0x70,0x61,0x6e,0x3d,
+    0x22,0x33,0x22,0x3e,0x3c,0x68,0x32,0x3e,0x44,0x61,0x74,0x65,0x69,0x65,0x6e,0x3c,
+    0x2f,0x68,0x32,0x3e,0x3c,0x2f,0x74,0x64,0x3e,0x3c,0x2f,0x74,0x72,0x3e,0x20,0x7b,
+    0x7b,0x23,0x66,0x69,0x6c,0x65,0x73,0x7d,0x7d,0x20,0x3c,0x74,0x72,0x3e,0x3c,0x74,
+    0x64,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x7b,0x7b,0x6e,0x61,0x6d,
+    0x65,0x7d,0x7d,0x22,0x3e,0x7b,0x7b,0x6e,0x61,0x6d,0x65,0x7d,0x7d,0x3c,0x2f,0x61,
+    0x3e,0x3c,0x2f,0x74,0x64,0x3e,0x3c,0x74,0x64,0x3e,0x7b,0x7b,0x73,0x69,0x7a,0x65,
+    0x7d,0x7d,0x42,0x3c,0x2f,0x74,0x64,0x3e,0x3c,0x74,0x64,0x3e,0x3c,0x61,0x20,0x68,
+    0x72,0x65,0x66,0x3d,0x22,0x2f,0x62,0x72,0x6f,0x77,0x73,0x65,0x3f,0x63,0x6d,0x64,
+    0x3d,0x64,0x65,0x6c,0x26,0x61,0x6d,0x70,0x3b,0x66,0x69,0x6c,0x65,0x3d,0x7b,0x7b,
+    0x6e,0x61,0x6d,0x65,0x5f,0x75,0x72,0x6c,0x7d,0x7d,0x22,0x3e,0x58,0x3c,0x2f,0x61,
+    0x3e,0x3c,0x2f,0x74,0x64,0x3e,0x3c,0x2f,0x74,0x72,0x3e,0x20,0x7b,0x7b,0x2f,0x66,
+    0x69,0x6c,0x65,0x73,0x7d,0x7d,0x20,0x3c,0x2f,0x74,0x61,0x62,0x6c,0x65,0x3e,0x3c,
+    0x2f,0x64,0x69,0x76,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x2f,0x62,0x6f,0x64,
+    0x79,0x3e,0x3c,0x2f,0x68,0x74,0x6d,0x6c,0x3e,
+};
+
+// /log.tmpl, 803 bytes
+static const uint8_t bundle_log_tmpl[] PROGMEM={
+    0x3c,0x68,0x74,0x6d,0x6c,0x3e,0x3c,0x68,0x65,0x61,0x64,0x3e,0x3c,0x74,0x69,0x74,
+    0x6c,0x65,0x3e,0x4c,0x48,0x57,0x65,0x62,0x3c,0x2f,0x74,0x69,0x74,0x6c,0x65,0x3e,
+    0x3c,0x6d,0x65,0x74,0x61,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x65,0x77,
+    0x70,0x6f,0x72,0x74,0x22,0x20,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x3d,0x22,0x77,
+    0x69,0x64,0x74,0x68,0x3d,0x64,0x65,0x76,0x69,0x63,0x65,0x2d,0x77,0x69,0x64,0x74,
+    0x68,0x2c,0x20,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x2d,0x73,0x63,0x61,0x6c,0x65,
+    0x3d,0x31,0x22,0x3e,0x3c,0x6c,0x69,0x6e,0x6b,0x20,0x72,0x65,0x6c,0x3d,0x22,0x73,
+    0x74,0x79,0x6c,0x65,0x73,0x68,0x65,0x65,0x74,0x22,0x20,0x68,0x72,0x65,0x66,0x3d,
+    0x22,0x77,0x33,0x2e,0x63,0x73,0x73,0x22,0x3e,0x3c,0x73,0x74,0x79,0x6c,0x65,0x3e,
+    0x3c,0x2f,0x73,0x74,0x79,0x6c,0x65,0x3e,0x3c,0x2f,0x68,0x65,0x61,0x64,0x3e,0x3c,
+    0x62,0x6f,0x64,0x79,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
+    0x22,0x77,0x33,0x2d,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x20,0x77,0x33,
+    0x2d,0x74,0x65,0x61,0x6c,0x22,0x3e,0x3c,0x68,0x31,0x3e,0x4c,0x48,0x57,0x65,0x62,
+    0x3c,0x2f,0x68,0x31,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x75,0x6c,0x20,0x63,
+    0x6c,0x61,0x73,0x73,0x3d,0x22,0x77,0x33,0x2d,0x6e,0x61,0x76,0x62,0x61,0x72,0x20,
+    0x77,0x33,0x2d,0x6c,0x69,0x67,0x68,0x74,0x2d,0x62,0x6c,0x75,0x65,0x22,0x3e,0x3c,
+    0x6c,0x69,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x2f,0x22,0x3e,0x48,
+    0x6f,0x6d,0x65,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x3c,0x6c,0x69,0x3e,
+    0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x2f,0x77,0x65,0x62,0x63,0x6f,0x6e,
+    0x66,0x69,0x67,0x22,0x3e,0x57,0x65,0x62,0x20,0x43,0x6f,0x6e,0x66,0x69,0x67,0x3c,
+    0x2f,0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x3c,0x6c,0x69,0x3e,0x3c,0x61,0x20,0x68,
+    0x72,0x65,0x66,0x3d,0x22,0x2f,0x75,0x73,0x65,0x72,0x63,0x6f,0x6e,0x66,0x69,0x67,
+    0x22,0x3e,0x55,0x73,0x65,0x72,0x20,0x43,0x6f,0x6e,0x66,0x69,0x67,0x3c,0x2f,0x61,
+    0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x3c,0x6c,0x69,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,
+    0x66,0x3d,0x22,0x2f,0x62,0x72,0x6f,0x77,0x73,0x65,0x22,0x3e,0x46,0x69,0x6c,0x65,
+    0x20,0x42,0x72,0x6f,0x77,0x73,0x65,0x72,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,0x69,
+    0x3e,0x3c,0x6c,0x69,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x77,0x33,0x2d,0x77,
+    0x68,0x69,0x74,0x65,0x22,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x2f,
+    0x73,0x68,0x6f,0x77,0x6c,0x6f,0x67,0x22,0x3e,0x4c,0x6f,0x67,0x3c,0x2f,0x61,0x3e,
+    0x3c,0x2f,0x6c,0x69,0x3e,0x3c,0x6c,0x69,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,
+    0x3d,0x22,0x2f,0x64,0x6f,0x63,0x75,0x2e,0x68,0x74,0x6d,0x6c,0x22,0x3e,0x44,0x6f,
+    0x63,0x75,0x6d,0x65,0x6e,0x74,0x61,0x74,0x69,0x6f,0x6e,0x3c,0x2f,0x61,0x3e,0x3c,
+    0x2f,0x6c,0x69,0x3e,0x3c,0x2f,0x75,0x6c,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,
+    0x61,0x73,0x73,0x3d,0x22,0x77,0x33,0x2d,0x72,0x6f,0x77,0x2d,0x70,0x61,0x64,0x64,
+    0x69,0x6e,0x67,0x20,0x77,0x33,0x2d,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x2d,0x36,
+    0x34,0x20,0x77,0x33,0x2d,0x74,0x68,0x65,0x6d,0x65,0x2d,0x6c,0x31,0x22,0x3e,0x3c,
+    0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x77,0x33,0x2d,0x63,0x6f,
+    0x6c,0x20,0x6d,0x31,0x32,0x22,0x3e,0x3c,0x74,0x61,0x62,0x6c,0x65,0x20,0x63,0x6c,
+    0x61,0x73,0x73,0x3d,0x22,0x77,0x33,0x2d,0x74,0x61,0x62,0x6c,0x65,0x20,0x77,0x33,
+    0x2d,0x62,0x6f,0x72,0x64,0x65,0x72,0x65,0x64,0x20,0x77,0x33,0x2d,0x73,0x74,0x72,
+    0x69,0x70,0x65,0x64,0x20,0x77,0x33,0x2d,0x63,0x61,0x72,0x64,0x2d,0x34,0x22,0x3e,
+    0x3c,0x74,0x72,0x3e,0x3c,0x74,0x64,0x3e,0x3c,0x68,0x32,0x3e,0x53,0x79,0x73,0x74,
+    0x65,0x6d,0x20,0x4c,0x6f,0x67,0x3c,0x2f,0x68,0x32,0x3e,0x3c,0x2f,0x74,0x64,0x3e,
+    0x3c,0x2f,0x74,0x72,0x3e,0x20,0x7b,0x7b,0x23,0x6c,0x6f,0x67,0x7d,0x7d,0x20,0x3c,
+    0x74,0x72,0x3e,0x3c,0x74,0x64,0x3e,0x7b,0x7b,0x65,0x6e,0x74,0x72,0x79,0x7d,0x7d,
+    0x3c,0x2f,0x74,0x64,0x3e,0x3c,0x2f,0x74,0x72,0x3e,0x20,0x7b,0x7b,0x2f,0x6c,0x6f,
+    0x67,0x7d,0x7d,0x20,0x3c,0x2f,0x74,0x61,0x62,0x6c,0x65,0x3e,0x3c,0x2f,0x64,0x69,
+    0x76,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x77,0x33,
+    0x2d,0x63,0x6f,0x6c,0x20,0x6d,0x31,0x22,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,
+    0x2f,0x64,0x69,0x76,0x3e,0x3c,0x2f,0x62,0x6f,0x64,0x79,0x3e,0x3c,0x2f,0x68,0x74,
+    0x6d,0x6c,0x3e,
+};
+
+// /userconfig.tmpl, 1048 bytes
+static const uint8_t bundle_userconfig_tmpl[] PROGMEM={
+    0x3c,0x68,0x74,0x6d,0x6c,0x3e,0x3c,0x68,0x65,0x61,0x64,0x3e,0x3c,0x74,0x69,0x74,
+    0x6c,0x65,0x3e,0x4c,0x48,0x57,0x65,0x62,0x3c,0x2f,0x74,0x69,0x74,0x6c,0x65,0x3e,
+    0x3c,0x6d,0x65,0x74,0x61,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x69,0x65,0x77,
+    0x70,0x6f,0x72,0x74,0x22,0x20,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x3d,0x22,0x77,
+    0x69,0x64,0x74,0x68,0x3d,0x64,0x65,0x76,0x69,0x63,0x65,0x2d,0x77,0x69,0x64,0x74,
+    0x68,0x2c,0x20,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x2d,0x73,0x63,0x61,0x6c,0x65,
+    0x3d,0x31,0x22,0x3e,0x3c,0x6c,0x69,0x6e,0x6b,0x20,0x72,0x65,0x6c,0x3d,0x22,0x73,
+    0x74,0x79,0x6c,0x65,0x73,0x68,0x65,0x65,0x74,0x22,0x20,0x68,0x72,0x65,0x66,0x3d,
+    0x22,0x77,0x33,0x2e,0x63,0x73,0x73,0x22,0x3e,0x3c,0x73,0x74,0x79,0x6c,0x65,0x3e,
+    0x3c,0x2f,0x73,0x74,0x79,0x6c,0x65,0x3e,0x3c,0x2f,0x68,0x65,0x61,0x64,0x3e,0x3c,
+    0x62,0x6f,0x64,0x79,0x3e,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
+    0x22,0x77,0x33,0x2d,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x20,0x77,0x33,
+    0x2d,0x74,0x65,0x61,0x6c,0x22,0x3e,0x3c,0x68,0x31,0x3e,0x4c,0x48,0x57,0x65,0x62,
+    0x3c,0x2f,0x68,0x31,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x75,0x6c,0x20,0x63,
+    0x6c,0x61,0x73,0x73,0x3d,0x22,0x77,0x33,0x2d,0x6e,0x61,0x76,0x62,0x61,0x72,0x20,
+    0x77,0x33,0x2d,0x6c,0x69,0x67,0x68,0x74,0x2d,0x62,0x6c,0x75,0x65,0x22,0x3e,0x3c,
+    0x6c,0x69,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x2f,0x22,0x3e,0x48,
+    0x6f,0x6d,0x65,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x3c,0x6c,0x69,0x3e,
+    0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x2f,0x77,0x65,0x62,0x63,0x6f,0x6e,
+    0x66,0x69,0x67,0x22,0x3e,0x57,0x65,0x62,0x20,0x43,0x6f,0x6e,0x66,0x69,0x67,0x3c,
+    0x2f,0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x3c,0x6c,0x69,0x20,0x63,0x6c,0x61,0x73,
+    0x73,0x3d,0x22,0x77,0x33,0x2d,0x77,0x68,0x69,0x74,0x65,0x22,0x3e,0x3c,0x61,0x20,
+    0x68,0x72,0x65,0x66,0x3d,0x22,0x2f,0x75,0x73,0x65,0x72,0x63,0x6f,0x6e,0x66,0x69,
+    0x67,0x22,0x3e,0x55,0x73,0x65,0x72,0x20,0x43,0x6f,0x6e,0x66,0x69,0x67,0x3c,0x2f,
+    0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x3c,0x6c,0x69,0x3e,0x3c,0x61,0x20,0x68,0x72,
+    0x65,0x66,0x3d,0x22,0x2f,0x62,0x72,0x6f,0x77,0x73,0x65,0x22,0x3e,0x46,0x69,0x6c,
+    0x65,0x20,0x42,0x72,0x6f,0x77,0x73,0x65,0x72,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,
+    0x69,0x3e,0x3c,0x6c,0x69,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x2f,
+    0x73,0x68,0x6f,0x77,0x6c,0x6f,0x67,0x22,0x3e,0x4c,0x6f,0x67,0x3c,0x2f,0x61,0x3e,
+    0x3c,0x2f,0x6c,0x69,0x3e,0x3c,0x6c,0x69,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,
+    0x3d,0x22,0x2f,0x64,0x6f,0x63,0x75,0x2e,0x68,0x74,0x6d,0x6c,0x22,0x3e,0x44,0x6f,
+    0x63,0x75,0x6d,0x65,0x6e,0x74,0x61,0x74,0x69,0x6f,0x6e,0x3c,0x2f,0x61,0x3e,0x3c,
+    0x2f,0x6c,0x69,0x3e,0x3c,0x2f,0x75,0x6c,0x3e,0x20,0x7b,0x7b,0x62,0x61,0x6e,0x6e,
+    0x65,0x72,0x7d,0x7d,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
+    0x22,0x77,0x33,0x2d,0x72,0x6f,0x77,0x2d,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x20,
+    0x77,0x33,0x2d,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x2d,0x36,0x34,0x20,0x77,0x33,
+    0x2d,0x74,0x68,0x65,0x6d,0x65,0x2d,0x6c,0x31,0x22,0x3e,0x3c,0x64,0x69,0x76,0x20,
+    0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x77,0x33,0x2d,0x63,0x6f,0x6c,0x20,0x6d,0x31,
+    0x32,0x22,0x3e,0x3c,0x66,0x6f,0x72,0x6d,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,
+    0x77,0x33,0x2d,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x22,0x20,0x6d,0x65,
+    0x74,0x68,0x6f,0x64,0x3d,0x22,0x70,0x6f,0x73,0x74,0x22,0x3e,0x3c,0x74,0x61,0x62,
+    0x6c,0x65,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x77,0x33,0x2d,0x74,0x61,0x62,
+    0x6c,0x65,0x20,0x77,0x33,0x2d,0x62,0x6f,0x72,0x64,0x65,0x72,0x65,0x64,0x20,0x77,
+    0x33,0x2d,0x73,0x74,0x72,0x69,0x70,0x65,0x64,0x20,0x77,0x33,0x2d,0x63,0x61,0x72,
+    0x64,0x2d,0x34,0x22,0x3e,0x3c,0x74,0x72,0x3e,0x3c,0x74,0x64,0x20,0x63,0x6f,0x6c,
+    0x73,0x70,0x61,0x6e,0x3d,0x22,0x32,0x22,0x3e,0x3c,0x68,0x32,0x3e,0x55,0x73,0x65,
+    0x72,0x20,0x43,0x6f,0x6e,0x66,0x69,0x67,0x3c,0x2f,0x68,0x32,0x3e,0x3c,0x2f,0x74,
+    0x64,0x3e,0x3c,0x2f,0x74,0x72,0x3e,0x20,0x7b,0x7b,0x23,0x75,0x73,0x65,0x72,0x63,
+    0x6f,0x6e,0x66,0x69,0x67,0x7d,0x7d,0x20,0x3c,0x74,0x72,0x3e,0x3c,0x74,0x64,0x3e,
+    0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x77,0x33,
+    0x2d,0x69,0x6e,0x70,0x75,0x74,0x22,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x74,0x65,
+    0x78,0x74,0x22,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6b,0x65,0x79,0x5f,0x7b,0x7b,
+    0x69,0x6e,0x64,0x65,0x78,0x7d,0x7d,0x22,0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,0x22,
+    0x7b,0x7b,0x6b,0x65,0x79,0x7d,0x7d,0x22,0x3e,0x3c,0x2f,0x74,0x64,0x3e,0x3c,0x74,
+    0x64,0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,
+    0x77,0x33,0x2d,0x69,0x6e,0x70,0x75,0x74,0x22,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,
+    0x74,0x65,0x78,0x74,0x22,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x76,0x61,0x6c,0x5f,
+    0x7b,0x7b,0x69,0x6e,0x64,0x65,0x78,0x7d,0x7d,0x22,0x20,0x76,0x61,0x6c,0x75,0x65,
+    0x3d,0x22,0x7b,0x7b,0x76,0x61,0x6c,0x7d,0x7d,0x22,0x3e,0x3c,0x2f,0x74,0x64,0x3e,
+    0x3c,0x2f,0x74,0x72,0x3e,0x20,0x7b,0x7b,0x2f,0x75,0x73,0x65,0x72,0x63,0x6f,0x6e,
+    0x66,0x69,0x67,0x7d,0x7d,0x20,0x3c,0x2f,0x74,0x61,0x62,0x6c,0x65,0x3e,0x3c,0x70,
+    0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x73,0x75,
+    0x62,0x6d,0x69,0x74,0x22,0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,0x22,0x53,0x61,0x76,
+    0x65,0x22,0x3e,0x3c,0x2f,0x70,0x3e,0x3c,0x2f,0x66,0x6f,0x72,0x6d,0x3e,0x3c,0x2f,
+    0x64,0x69,0x76,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x2f,0x62,0x6f,0x64,0x79,
+    0x3e,0x3c,0x2f,0x68,0x74,0x6d,0x6c,0x3e,
+};
+
+static const char* bundle_paths[BUNDLE_COUNT]={
+    "/w3.css",
+    "/w3.css.gz",
+    "/index.tmpl",
+    "/webconfig.tmpl",
+    "/browse.tmpl",
+    "/log.tmpl",
+    "/userconfig.tmpl",
+};
+
+static const uint8_t* const bundle_data[BUNDLE_COUNT]={
+    bundle_w3_css,
+    bundle_w3_css_gz,
+    bundle_index_tmpl,
+    bundle_webconfig_tmpl,
+    bundle_browse_tmpl,
+    bundle_log_tmpl,
+    bundle_userconfig_tmpl,
+};
+
+// path hash, size, CRC32, mime type, flags
+static const LHWeb::Asset bundle_assets[BUNDLE_COUNT]={
+    { 0x09a35059, 5268, 0x262c55c6, 3, 0x03 },
+    { 0x04af2e24, 1797, 0xe14e90f8, 13, 0x02 },
+    { 0x44fe3ebb, 1508, 0x5eaa877f, 0, 0x02 },
+    { 0xa7ef0c87, 1136, 0xfc9a3dc9, 0, 0x02 },
+    { 0x542f8525, 889, 0x709ecb17, 0, 0x02 },
+    { 0x8623d485, 803, 0x8d671af4, 0, 0x02 },
+    { 0xb5217368, 1048, 0xfb97f187, 0, 0x02 },
+};
+
+#endif
@@ -0,0 +1,224 @@
+#include "lhdeflate.h"
+
+#define DEFLATE_BUFFER (2*DEFLATE_WINDOW)
+#define DEFLATE_HASH_SIZE (1<<DEFLATE_HASH_BITS)
+
+// base values and extra bits of the length codes 257..285
+static const uint16_t length_base[29]={
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+static const uint8_t length_extra[29]={
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+    3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+
+// base values and extra bits of the distance codes 0..29
+static const uint16_t distance_base[30]={
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577
+};
+static const uint8_t distance_extra[30]={
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+    7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
+
+
+LHDeflate::LHDeflate(Print &out): out(out){
+}
+
+LHDeflate::~LHDeflate(){
+    release();
+}
+
+
+bool LHDeflate::begin(){
+    buf=(uint8_t*)malloc(DEFLATE_BUFFER);
+    head=(uint16_t*)malloc(DEFLATE_HASH_SIZE*sizeof(uint16_t));
+    if(buf==NULL || head==NULL){
+        release();
+        return false;
+    }
+    memset(head, 0, DEFLATE_HASH_SIZE*sizeof(uint16_t));
+    len=0;
+    pos=0;
+    bits=0;
+    bit_count=0;
+    crc=0;
+    total=0;
+
+    // gzip header: magic, deflate, no flags, no mtime, unknown OS
+    static const uint8_t header[10]={ 0x1f, 0x8b, 0x08, 0, 0, 0, 0, 0, 0, 0xff };
+    out.write(header, sizeof(header));
+
+    // one final block with fixed huffman codes for the whole stream
+    putBits(1, 1);
+    putBits(1, 2);
+    return true;
+}
+
+
+size_t LHDeflate::write(uint8_t c){
+    return write(&c, 1);
+}
+
+
+size_t LHDeflate::write(const uint8_t *data, size_t size){
+    if(buf==NULL) return 0;
+    crc=crc32(crc, data, size);
+    total+=size;
+
+    size_t done=0;
+    while(done<size){
+        size_t n=DEFLATE_BUFFER-len;
+        if(n>size-done) n=size-done;
+        memcpy(buf+len, data+done, n);
+        len+=n;
+        done+=n;
+        if(len==DEFLATE_BUFFER) compress(false);
+    }
+    return size;
+}
+
+
+void LHDeflate::finish(){
+    if(buf==NULL) return;
+    compress(true);
+    putSymbol(256);
+
+    // pad to a byte boundary
+    if(bit_count>0) putBits(0, 8-bit_count);
+
+    uint8_t trailer[8];
+    for(uint8_t i=0; i<4; i++){
+        trailer[i]=(crc>>(8*i)) & 0xFF;
+        trailer[4+i]=(total>>(8*i)) & 0xFF;
+    }
+    out.write(trailer, sizeof(trailer));
+    release();
+}
+
+
+void LHDeflate::release(){
+    free(buf);
+    free(head);
+    buf=NULL;
+    head=NULL;
+}
+
+
+uint16_t LHDeflate::hash(size_t p){
+    return ((buf[p]<<6) ^ (buf[p+1]<<3) ^ buf[p+2]) & (DEFLATE_HASH_SIZE-1);
+}
+
+
+// encodes the buffered input, without flush a full match length is
+// kept as lookahead. Afterwards the buffer is moved so that one
+// window of history stays in front of pos.
+void LHDeflate::compress(bool flush){
+    while(pos<len && (flush || pos+DEFLATE_MAX_MATCH<=len)){
+        size_t best_len=0;
+        size_t best_dist=0;
+
+        if(pos+3<=len){
+            uint16_t h=hash(pos);
+            size_t candidate=head[h];
+            head[h]=pos+1;
+            if(candidate>0 && pos-(candidate-1)<=DEFLATE_WINDOW){
+                candidate--;
+                size_t max=len-pos;
+                if(max>DEFLATE_MAX_MATCH) max=DEFLATE_MAX_MATCH;
+                size_t l=0;
+                while(l<max && buf[candidate+l]==buf[pos+l]) l++;
+                if(l>=3){
+                    best_len=l;
+                    best_dist=pos-candidate;
+                }
+            }
+        }
+
+        if(best_len>0){
+            putMatch(best_len, best_dist);
+            for(size_t i=1; i<best_len && pos+i+3<=len; i++){
+                head[hash(pos+i)]=pos+i+1;
+            }
+            pos+=best_len;
+        }else{
+            putSymbol(buf[pos]);
+            pos++;
+        }
+    }
+
+    if(pos>DEFLATE_WINDOW){
+        size_t shift=pos-DEFLATE_WINDOW;
+        memmove(buf, buf+shift, len-shift);
+        len-=shift;
+        pos-=shift;
+        for(uint16_t i=0; i<DEFLATE_HASH_SIZE; i++){
+            head[i]= head[i]>shift ? head[i]-shift : 0;
+        }
+    }
+}
+
+
+// deflate writes everything lsb first, except huffman codes
+void LHDeflate::putBits(uint32_t value, uint8_t count){
+    bits|=value<<bit_count;
+    bit_count+=count;
+    while(bit_count>=8){
+        out.write((uint8_t)(bits & 0xFF));
+        bits>>=8;
+        bit_count-=8;
+    }
+}
+
+void LHDeflate::putCode(uint16_t code, uint8_t count){
+    uint16_t reversed=0;
+    for(uint8_t i=0; i<count; i++){
+        reversed=(reversed<<1) | (code & 1);
+        code>>=1;
+    }
+    putBits(reversed, count);
+}
+
+
+// fixed huffman code of a literal/length symbol
+void LHDeflate::putSymbol(uint16_t symbol){
+    if(symbol<144){
+        putCode(0x30+symbol, 8);
+    }else if(symbol<256){
+        putCode(0x190+symbol-144, 9);
+    }else if(symbol<280){
+        putCode(symbol-256, 7);
+    }else{
+        putCode(0xC0+symbol-280, 8);
+    }
+}
+
+
+void LHDeflate::putMatch(uint16_t length, uint16_t distance){
+    uint8_t code=28;
+    while(length_base[code]>length) code--;
+    putSymbol(257+code);
+    putBits(length-length_base[code], length_extra[code]);
+
+    code=29;
+    while(distance_base[code]>distance) code--;
+    putCode(code, 5);
+    putBits(distance-distance_base[code], distance_extra[code]);
+}
+
+
+uint32_t LHDeflate::crc32(uint32_t crc, const uint8_t* buf, size_t len){
+    static const uint32_t table[16]={
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+        0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+    };
+    crc=~crc;
+    while(len--){
+        crc^=*buf++;
+        crc=(crc>>4)^table[crc&0x0F];
+        crc=(crc>>4)^table[crc&0x0F];
+    }
+    return ~crc;
+}
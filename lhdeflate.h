@@ -0,0 +1,49 @@
+#ifndef LHDEFLATE_H
+#define LHDEFLATE_H
+
+#include <Arduino.h>
+
+#define DEFLATE_WINDOW 1024         // history searched for matches, power of two
+#define DEFLATE_HASH_BITS 9
+#define DEFLATE_MAX_MATCH 258
+
+// Streaming gzip compressor for generated pages.
+// Uses a small window, a single probe hash and the fixed huffman
+// codes of deflate, so it needs about 3KB of heap between begin()
+// and finish() and no dynamic tree building.
+class LHDeflate: public Print{
+  public:
+    LHDeflate(Print &out);
+    ~LHDeflate();
+
+    // allocates the buffers and writes the gzip header
+    // returns false if there is not enough memory
+    bool begin();
+    size_t write(uint8_t c);
+    size_t write(const uint8_t *data, size_t len);
+    // compresses what is left and writes the gzip trailer
+    void finish();
+
+    static uint32_t crc32(uint32_t crc, const uint8_t* buf, size_t len);
+
+  private:
+    Print &out;
+    uint8_t *buf=NULL;              // 2*DEFLATE_WINDOW bytes, history and lookahead
+    uint16_t *head=NULL;            // last position+1 of each hash
+    size_t len=0;
+    size_t pos=0;
+    uint32_t bits=0;
+    uint8_t bit_count=0;
+    uint32_t crc=0;
+    uint32_t total=0;
+
+    void compress(bool flush);
+    uint16_t hash(size_t p);
+    void putBits(uint32_t value, uint8_t count);
+    void putCode(uint16_t code, uint8_t count);
+    void putSymbol(uint16_t symbol);
+    void putMatch(uint16_t length, uint16_t distance);
+    void release();
+};
+
+#endif
@@ -0,0 +1,182 @@
+#include "lhrouter.h"
+
+#define NODE_PARAM 0x01             // {name} segment
+#define NODE_OWNS_LABEL 0x02        // label was allocated for this node, others are slices of it
+
+
+LHRouter::LHRouter(){
+    memset(&root, 0, sizeof(root));
+    root.label="";
+}
+
+
+LHRouter::~LHRouter(){
+    clear(root.child);
+}
+
+
+void LHRouter::clear(Node *node){
+    while(node){
+        Node *next=node->next;
+        clear(node->child);
+        if(node->flags & NODE_OWNS_LABEL) delete[] node->label;
+        delete node->func;
+        delete node;
+        node=next;
+    }
+}
+
+
+LHRouter::Node* LHRouter::newNode(const char* label, size_t len, uint8_t flags){
+    char *copy=new char[len];
+    memcpy(copy, label, len);
+    Node *node=new Node();
+    node->label=copy;
+    node->len=len;
+    node->flags=flags | NODE_OWNS_LABEL;
+    node->child=NULL;
+    node->next=NULL;
+    node->func=NULL;
+    return node;
+}
+
+
+void LHRouter::on(const char* pattern, TRouteFunction func){
+    Node *node=insert(pattern);
+    if(node->func) return;
+    node->func=new TRouteFunction(func);
+    routes++;
+}
+
+
+// returns the node of the pattern, creating and splitting nodes on the way
+LHRouter::Node* LHRouter::insert(const char* pattern){
+    Node *node=&root;
+    const char *p=pattern;
+    while(*p){
+        if(*p=='{'){
+            const char *end=strchr(p, '}');
+            if(end==NULL) end=p+strlen(p);
+            size_t len=end-p-1;
+            if(len>ROUTER_LABEL) len=ROUTER_LABEL;
+
+            // parameters go to the end of the list, after the static labels
+            Node **link=&node->child;
+            while(*link && !((*link)->flags & NODE_PARAM && (*link)->len==len && strncmp((*link)->label, p+1, len)==0)){
+                link=&(*link)->next;
+            }
+            if(*link==NULL) *link=newNode(p+1, len, NODE_PARAM);
+            node=*link;
+            p= *end ? end+1 : end;
+            continue;
+        }
+
+        size_t run=0;
+        while(p[run] && p[run]!='{' && run<ROUTER_LABEL) run++;
+
+        // at most one static child starts with the same character
+        Node *child=node->child;
+        while(child && (child->flags & NODE_PARAM || child->label[0]!=*p)) child=child->next;
+        if(child==NULL){
+            child=newNode(p, run, 0);
+            child->next=node->child;
+            node->child=child;
+            node=child;
+            p+=run;
+            continue;
+        }
+
+        size_t common=0;
+        while(common<child->len && common<run && child->label[common]==p[common]) common++;
+        if(common<child->len){
+            // split, the rest keeps the children and a slice of the label
+            Node *rest=new Node();
+            rest->label=child->label+common;
+            rest->len=child->len-common;
+            rest->flags=0;
+            rest->child=child->child;
+            rest->next=NULL;
+            rest->func=child->func;
+            child->len=common;
+            child->child=rest;
+            child->func=NULL;
+        }
+        node=child;
+        p+=common;
+    }
+    return node;
+}
+
+
+// depth first, static labels before parameters
+LHRouter::Node* LHRouter::match(Node *node, const char* rest, uint8_t depth){
+    if(*rest==0){
+        if(node->func==NULL) return NULL;
+        param_count=depth;
+        return node;
+    }
+    for(Node *child=node->child; child; child=child->next){
+        if(child->flags & NODE_PARAM){
+            size_t len=0;
+            while(rest[len] && rest[len]!='/') len++;
+            if(len==0 || len>255 || depth>=ROUTER_PARAMS) continue;
+            Node *found=match(child, rest+len, depth+1);
+            if(found){
+                param_nodes[depth]=child;
+                param_start[depth]=rest-path.c_str();
+                param_len[depth]=len;
+                return found;
+            }
+        }else if(strncmp(child->label, rest, child->len)==0){
+            Node *found=match(child, rest+child->len, depth);
+            if(found) return found;
+        }
+    }
+    return NULL;
+}
+
+
+TRouteFunction* LHRouter::find(const char* uri){
+    path=uri;
+    param_count=0;
+    Node *node=match(&root, path.c_str(), 0);
+    return node ? node->func : NULL;
+}
+
+
+void LHRouter::swap(LHRouter &other){
+    Node *child=root.child;
+    root.child=other.root.child;
+    other.root.child=child;
+    TRouteFunction *func=root.func;
+    root.func=other.root.func;
+    other.root.func=func;
+    size_t n=routes;
+    routes=other.routes;
+    other.routes=n;
+    param_count=other.param_count=0;
+}
+
+
+String LHRouter::getParameter(const char* name){
+    size_t len=strlen(name);
+    for(uint8_t i=0; i<param_count; i++){
+        if(param_nodes[i]->len==len && strncmp(param_nodes[i]->label, name, len)==0){
+            return path.substring(param_start[i], param_start[i]+param_len[i]);
+        }
+    }
+    return String();
+}
+
+
+bool LHRouterHandler::canHandle(HTTPMethod method, String uri){
+    current=router.find(uri.c_str());
+    return current!=NULL;
+}
+
+
+bool LHRouterHandler::handle(ESP8266WebServer &server, HTTPMethod method, String uri){
+    if(current==NULL) return false;
+    (*current)();
+    return true;
+}
@@ -0,0 +1,69 @@
+#ifndef LHROUTER_H
+#define LHROUTER_H
+
+#include <Arduino.h>
+#include <ESP8266WebServer.h>
+#include <functional>
+
+#define ROUTER_PARAMS 4             // {name} segments in one pattern
+#define ROUTER_LABEL 255            // longest label of one node
+
+typedef std::function<void(void)> TRouteFunction;
+
+// Radix tree of paths. Patterns may contain {name} segments that match
+// any non-empty part of the path up to the next '/', their values are
+// available through getParameter() after a match. A lookup walks the
+// path once, so the cost depends on its length, not on the number of
+// routes. Static labels win over parameters, the first registration
+// of a pattern wins like in ESP8266WebServer.
+class LHRouter{
+  public:
+    LHRouter();
+    ~LHRouter();
+    // eg on("/channel/{ch}/{cmd}", func), the pattern is copied
+    void on(const char* pattern, TRouteFunction func);
+    // handler of the path or NULL
+    TRouteFunction* find(const char* path);
+    // value of a {name} segment of the last match, "" if there is none
+    String getParameter(const char* name);
+    // exchanges the routes with another router
+    void swap(LHRouter &other);
+    size_t routes=0;
+
+  private:
+    class Node {
+    public:
+        const char* label;          // static text or the parameter name, not terminated
+        Node *child;
+        Node *next;
+        TRouteFunction *func;
+        uint8_t len;
+        uint8_t flags;
+    };
+    Node root;
+    String path;                    // copy of the last path, the values point into it
+    const Node *param_nodes[ROUTER_PARAMS];
+    uint16_t param_start[ROUTER_PARAMS];
+    uint8_t param_len[ROUTER_PARAMS];
+    uint8_t param_count=0;
+
+    Node* newNode(const char* label, size_t len, uint8_t flags);
+    Node* insert(const char* pattern);
+    Node* match(Node *node, const char* rest, uint8_t depth);
+    void clear(Node *node);
+};
+
+// hands the requests ESP8266WebServer did not match otherwise to a
+// router. The server deletes its handlers, so the router itself is
+// referenced and stays with its owner.
+class LHRouterHandler: public RequestHandler{
+  public:
+    LHRouterHandler(LHRouter &router): router(router){}
+    bool canHandle(HTTPMethod method, String uri);
+    bool handle(ESP8266WebServer &server, HTTPMethod method, String uri);
+  private:
+    LHRouter &router;
+    TRouteFunction *current=NULL;
+};
+
+#endif
@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+"""Delta sync of the web assets to LHWeb nodes.
+
+Fetches /manifest from every node, compares the size and CRC32 of each
+file with the local copy and uploads only the files that differ.
+
+  ./lhsync.py 192.168.1.50
+  ./lhsync.py -z 192.168.1.50 192.168.1.51 192.168.1.52
+  ./lhsync.py --dry-run 192.168.1.50
+
+The files go through the same asset build as the firmware bundle (see
+mkbundle.py), so a node gets exactly what a fresh flash would serve.
+
+A single changed file goes to /upload with its CRC in X-Upload-CRC32,
+several changed files go to /deploy as one tar archive so the node
+swaps them in together. Nodes are updated in parallel.
+"""
+
+import argparse
+import http.client
+import io
+import os
+import sys
+import tarfile
+import zlib
+from concurrent.futures import ThreadPoolExecutor
+
+import mkbundle
+
+BOUNDARY = 'lhsyncboundary'
+
+
+def fetch_manifest(host, port, timeout):
+    conn = http.client.HTTPConnection(host, port, timeout=timeout)
+    try:
+        conn.request('GET', '/manifest')
+        resp = conn.getresponse()
+        data = resp.read()
+        if resp.status != 200:
+            raise RuntimeError('/manifest: HTTP %d' % resp.status)
+    finally:
+        conn.close()
+    manifest = {}
+    bundled = set()
+    for line in data.decode(errors='replace').splitlines():
+        fields = line.split()
+        if len(fields) >= 3:
+            manifest[fields[0]] = (int(fields[1]), int(fields[2], 16))
+            if fields[3:] == ['bundle']:
+                bundled.add(fields[0])
+    return manifest, bundled
+
+
+def sibling(path):
+    return path[:-3] if path.endswith('.gz') else path + '.gz'
+
+
+def changed_files(files, manifest, bundled):
+    paths = set(path for path, data in files.items()
+                if manifest.get(path) != (len(data), zlib.crc32(data)))
+    # a file in SPIFFS hides the bundled copy of its .gz variant and
+    # the other way round, so that one has to go along
+    paths |= set(sibling(p) for p in paths if sibling(p) in bundled and sibling(p) in files)
+    return sorted(paths)
+
+
+def post_file(host, port, timeout, uri, filename, data, headers=None):
+    body = (b'--' + BOUNDARY.encode() + b'\r\n'
+            b'Content-Disposition: form-data; name="file"; filename="' + filename.encode() + b'"\r\n'
+            b'Content-Type: application/octet-stream\r\n\r\n' + data +
+            b'\r\n--' + BOUNDARY.encode() + b'--\r\n')
+    headers = dict(headers or {})
+    headers['Content-Type'] = 'multipart/form-data; boundary=' + BOUNDARY
+    conn = http.client.HTTPConnection(host, port, timeout=timeout)
+    try:
+        conn.request('POST', uri, body, headers)
+        resp = conn.getresponse()
+        answer = resp.read().decode(errors='replace').strip()
+        if resp.status != 200:
+            raise RuntimeError('%s: HTTP %d %s' % (uri, resp.status, answer))
+    finally:
+        conn.close()
+
+
+def tar_bundle(files, paths):
+    buf = io.BytesIO()
+    with tarfile.open(fileobj=buf, mode='w', format=tarfile.USTAR_FORMAT) as tar:
+        for path in paths:
+            info = tarfile.TarInfo(path.lstrip('/'))
+            info.size = len(files[path])
+            tar.addfile(info, io.BytesIO(files[path]))
+    return buf.getvalue()
+
+
+def sync(host, files, args):
+    manifest, bundled = fetch_manifest(host, args.port, args.timeout)
+    paths = changed_files(files, manifest, bundled)
+    sent = sum(len(files[p]) for p in paths)
+    if args.dry_run or not paths:
+        return paths, sent
+    if len(paths) == 1:
+        data = files[paths[0]]
+        post_file(host, args.port, args.timeout, '/upload', paths[0], data,
+                  {'X-Upload-CRC32': '%08x' % zlib.crc32(data)})
+    else:
+        post_file(host, args.port, args.timeout, '/deploy', 'bundle.tar', tar_bundle(files, paths))
+    return paths, sent
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('hosts', nargs='+')
+    parser.add_argument('-z', dest='gzip', action='store_true', help='keep gzip variants of the static files in sync')
+    parser.add_argument('--full', action='store_true', help='send the files as they are, no stripping or minifying')
+    parser.add_argument('--dir', default=os.path.dirname(os.path.abspath(__file__)), help='directory of the web files')
+    parser.add_argument('--port', type=int, default=80)
+    parser.add_argument('--timeout', type=float, default=30)
+    parser.add_argument('--parallel', type=int, default=8, help='nodes updated at the same time')
+    parser.add_argument('--dry-run', action='store_true', help='only list the files that would be sent')
+    args = parser.parse_args()
+
+    files = dict(mkbundle.collect(args.dir, args.gzip, not args.full))
+    failed = 0
+    with ThreadPoolExecutor(args.parallel) as ex:
+        jobs = {host: ex.submit(sync, host, files, args) for host in args.hosts}
+        for host, job in jobs.items():
+            try:
+                paths, sent = job.result()
+                print('%-16s %d changed, %d bytes %s' % (host, len(paths), sent, ' '.join(paths)))
+            except Exception as e:
+                failed += 1
+                print('%-16s failed: %s' % (host, e))
+    sys.exit(1 if failed else 0)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,112 @@
+#!/usr/bin/env python3
+"""Collector for the multicast announcements of LHWeb nodes.
+
+Joins the group set with announce_group on the nodes and keeps a table
+of every node that was heard of: channel states, RSSI, uptime, free
+heap and the datagrams lost on the way, found by gaps in the sequence
+numbers.
+
+  ./lhwatch.py 239.255.76.72
+  ./lhwatch.py --port 4210 --log 239.255.76.72
+
+A node that rebooted starts counting at 1 again, that is not counted
+as loss.
+"""
+
+import argparse
+import socket
+import struct
+import sys
+import time
+
+
+class Node:
+    def __init__(self, addr):
+        self.addr = addr
+        self.seq = None
+        self.lost = 0
+        self.received = 0
+        self.uptime = self.rssi = self.heap = None
+        self.states = {}
+        self.seen = 0
+
+
+def parse(data):
+    lines = data.decode(errors='replace').splitlines()
+    if not lines:
+        return None
+    head = lines[0].split()
+    if len(head) < 4 or head[0] != 'lhweb':
+        return None
+    states = {}
+    for line in lines[1:]:
+        fields = line.split(' ', 1)
+        if len(fields) == 2:
+            states[fields[0]] = fields[1]
+    return head[1], int(head[2]), head[3], head[4:], states
+
+
+def update(nodes, addr, packet):
+    node_id, seq, kind, fields, states = packet
+    node = nodes.setdefault(node_id, Node(addr))
+    node.addr = addr
+    if node.seq is not None and seq > node.seq + 1:
+        node.lost += seq - node.seq - 1
+    node.seq = seq
+    node.received += 1
+    node.seen = time.time()
+    if kind == 'heartbeat' and len(fields) == 3:
+        node.uptime, node.rssi, node.heap = (int(f) for f in fields)
+    node.states.update(states)
+    return node
+
+
+def show(nodes):
+    out = ['\x1b[H\x1b[2J%-8s %-15s %8s %5s %6s %6s %5s  %s' % (
+        'node', 'address', 'uptime', 'rssi', 'heap', 'recv', 'lost', 'states')]
+    now = time.time()
+    for node_id in sorted(nodes):
+        n = nodes[node_id]
+        states = ' '.join('%s=%s' % kv for kv in sorted(n.states.items()))
+        stale = ' (%ds ago)' % (now - n.seen) if now - n.seen > 60 else ''
+        out.append('%-8s %-15s %8s %5s %6s %6d %5d  %s%s' % (
+            node_id, n.addr, n.uptime, n.rssi, n.heap, n.received, n.lost, states, stale))
+    sys.stdout.write('\n'.join(out) + '\n')
+    sys.stdout.flush()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('group')
+    parser.add_argument('--port', type=int, default=4210)
+    parser.add_argument('--log', action='store_true', help='print every datagram instead of the table')
+    args = parser.parse_args()
+
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM, socket.IPPROTO_UDP)
+    sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    sock.bind(('', args.port))
+    sock.setsockopt(socket.IPPROTO_IP, socket.IP_ADD_MEMBERSHIP,
+                    struct.pack('4s4s', socket.inet_aton(args.group), socket.inet_aton('0.0.0.0')))
+
+    nodes = {}
+    while True:
+        data, (addr, _) = sock.recvfrom(2048)
+        packet = parse(data)
+        if packet is None:
+            continue
+        # a reboot restarts the sequence
+        known = nodes.get(packet[0])
+        if known is not None and known.seq is not None and packet[1] <= known.seq:
+            known.seq = None
+        update(nodes, addr, packet)
+        if args.log:
+            print('%s %s %s' % (time.strftime('%H:%M:%S'), addr, data.decode(errors='replace').replace('\n', ' | ')))
+        else:
+            show(nodes)
+
+
+if __name__ == '__main__':
+    try:
+        main()
+    except KeyboardInterrupt:
+        pass
@@ -1,10 +1,380 @@
 #include "lhweb.h"
+#include "lhbundle.h"
 
 #define VERSION "LHWeb v0.1"
 
+#ifdef LHWEB_HEAP_TRACKING
+  #define HEAP_BEGIN() uint32_t heap_before=ESP.getFreeHeap()
+  #define HEAP_END(slot) heapRecord(slot, heap_before)
+#else
+  #define HEAP_BEGIN()
+  #define HEAP_END(slot)
+#endif
+
+// the index of a type is stored in the asset index, so never reorder
+static const char* mime_types[MIME_COUNT]={
+    "text/plain", "text/html", "text/html", "text/css", "application/javascript",
+    "image/png", "image/gif", "image/jpeg", "image/x-icon", "image/svg+xml",
+    "text/xml", "application/x-pdf", "application/x-zip", "application/x-gzip"
+};
+static const char* mime_extensions[MIME_COUNT]={
+    "", ".htm", ".html", ".css", ".js",
+    ".png", ".gif", ".jpg", ".ico", ".svg",
+    ".xml", ".pdf", ".zip", ".gz"
+};
+
+// max-age in seconds per mime type, 0 makes the browser revalidate every time
+static const unsigned long default_max_age[MIME_COUNT]={
+    0, 0, 0, 86400, 86400,
+    86400, 86400, 86400, 86400, 86400,
+    0, 0, 0, 0
+};
+
+static const char* rate_class_names[RATE_CLASSES]={ "static", "dynamic", "upload", "control" };
+// requests per minute and burst per route class
+static const uint16_t default_rate_per_minute[RATE_CLASSES]={ 1200, 300, 30, 600 };
+static const uint16_t default_rate_burst[RATE_CLASSES]={ 40, 20, 5, 20 };
+
+// request headers the web server has to keep for us, LHWebServer
+// needs Connection to decide about keep-alive
+static const char* request_headers[]={ "Accept-Encoding", "If-None-Match", "Range", "X-Upload-CRC32", "Connection" };
+
+
+LHWriter::LHWriter(LHWebServer &server, char* buf, size_t size): server(&server), buf(buf), size(size){
+}
+
+LHWriter::LHWriter(Print &out, char* buf, size_t size): out(&out), buf(buf), size(size){
+}
+
+size_t LHWriter::write(uint8_t c){
+    if(size==0) return out->write(c);
+    if(len>=size) flush();
+    buf[len++]=c;
+    return 1;
+}
+
+size_t LHWriter::write(const uint8_t *data, size_t n){
+    if(size==0) return out->write(data, n);
+    size_t done=0;
+    while(done<n){
+        if(len>=size) flush();
+        size_t part=size-len;
+        if(part>n-done) part=n-done;
+        memcpy(buf+len, data+done, part);
+        len+=part;
+        done+=part;
+    }
+    return n;
+}
+
+void LHWriter::flush(){
+    if(len==0) return;
+    if(server){
+        server->sendContent(buf, len);
+    }else{
+        out->write((const uint8_t*)buf, len);
+    }
+    len=0;
+}
+
+size_t LHWriter::printEscaped(const char* str){
+    size_t n=0;
+    const char* start=str;
+    for(; *str; str++){
+        const char* entity;
+        switch(*str){
+            case '&': entity="&amp;"; break;
+            case '<': entity="&lt;"; break;
+            case '>': entity="&gt;"; break;
+            case '"': entity="&quot;"; break;
+            case '\'': entity="&#39;"; break;
+            default: continue;
+        }
+        n+=write((const uint8_t*)start, str-start);
+        n+=print(entity);
+        start=str+1;
+    }
+    return n+write((const uint8_t*)start, str-start);
+}
+
+size_t LHWriter::printUrlEncoded(const char* str){
+    static const char hex[]="0123456789ABCDEF";
+    size_t n=0;
+    for(; *str; str++){
+        char c=*str;
+        if( (c>='0' && c<='9') || (c>='A' && c<='Z') || (c>='a' && c<='z') || c=='-' || c=='_' || c=='.' || c=='~' ){
+            n+=write(c);
+        }else{
+            n+=write('%');
+            n+=write(hex[(uint8_t)c>>4]);
+            n+=write(hex[c & 0x0F]);
+        }
+    }
+    return n;
+}
+
+size_t LHWriter::printSize(size_t value){
+    static const char prefixes[]={' ', 'K','M','G','T'};
+    uint8_t pre=0;
+    size_t val=value;
+    while(val>1024){
+        val/=1024;
+        pre++;
+    }
+    size_t n=print((unsigned long)val);
+    if(pre>0) n+=write(prefixes[pre]);
+    return n;
+}
+
+
+LHFlashFile::LHFlashFile(const uint8_t* data, size_t size, const char* name): data(data), len(size), file_name(name){
+}
+
+int LHFlashFile::available(){
+    return len-pos;
+}
+
+int LHFlashFile::read(){
+    if(pos>=len) return -1;
+    return pgm_read_byte(data+pos++);
+}
+
+size_t LHFlashFile::read(uint8_t* buf, size_t n){
+    if(n>len-pos) n=len-pos;
+    memcpy_P(buf, data+pos, n);
+    pos+=n;
+    return n;
+}
+
+int LHFlashFile::peek(){
+    if(pos>=len) return -1;
+    return pgm_read_byte(data+pos);
+}
+
+bool LHFlashFile::seek(size_t position){
+    if(position>len) return false;
+    pos=position;
+    return true;
+}
+
+
+void LHWebServer::handleClient(){
+    accept();
+
+    unsigned long now=millis();
+    for(uint8_t i=0; i<HTTP_CLIENTS; i++){
+        Connection &c=clients[i];
+        if(!c.tcp) continue;
+        if(!c.tcp.connected()){
+            drop(c);
+            continue;
+        }
+        if(!c.tcp.available()){
+            c.waiting=0;
+            if(now-c.last>HTTP_KEEPALIVE) drop(c);
+            continue;
+        }
+        // give a slow client some time to send the rest of the header,
+        // after that _parseRequest() waits for it or fails
+        if(c.waiting==0) c.waiting=now|1;
+        if(!headerComplete(c) && now-c.waiting<HTTP_MAX_DATA_WAIT) continue;
+        serve(c);
+    }
+}
+
+
+void LHWebServer::accept(){
+    if(!_server.hasClient()) return;
+    WiFiClient tcp=_server.available();
+
+    // a free slot, or the one idle for the longest time
+    unsigned long now=millis();
+    Connection *slot=NULL;
+    for(uint8_t i=0; i<HTTP_CLIENTS; i++){
+        Connection &c=clients[i];
+        if(!c.tcp || !c.tcp.connected()){
+            slot=&c;
+            break;
+        }
+        if(c.waiting==0 && (slot==NULL || now-c.last > now-slot->last)) slot=&c;
+    }
+    //no free spot, every connection has a request waiting
+    if(slot==NULL){
+        tcp.stop();
+        return;
+    }
+    if(slot->tcp) drop(*slot);
+    // header and body go out in separate writes, Nagle would hold the
+    // second one back until the client acks the first
+    tcp.setNoDelay(true);
+    slot->tcp=tcp;
+    slot->last=now;
+    slot->waiting=0;
+    slot->requests=0;
+    connections++;
+}
+
+
+// peekBytes() only sees the first segment that came in, if more than
+// that is waiting the header spans several segments and is (nearly) there
+bool LHWebServer::headerComplete(Connection &c){
+    char buf[HTTP_HEADER_MAX];
+    size_t len=c.tcp.peekBytes((uint8_t*)buf, sizeof(buf));
+    if(len==sizeof(buf) || len<(size_t)c.tcp.available()) return true;
+    for(size_t i=3; i<len; i++){
+        if(buf[i]=='\n' && buf[i-1]=='\r' && buf[i-2]=='\n' && buf[i-3]=='\r') return true;
+    }
+    return false;
+}
+
+
+// runs one request of the connection through the handlers. The core's
+// _parseRequest() reads exactly one request and ends with a flush().
+// Up to 2.4 that flush() throws away whatever is left in the receive
+// buffer, pipelined requests included, so those only get answered on
+// cores where flush() leaves the input alone (2.5 and later).
+void LHWebServer::serve(Connection &c){
+    _currentClient=c.tcp;
+    _currentStatus=HC_WAIT_READ;
+    _statusChange=millis();
+    _chunked=false;
+    keep_alive=true;
+    // the core parses HEAD as GET, only the request line tells them apart
+    char method[5];
+    head=c.tcp.peekBytes((uint8_t*)method, sizeof(method))==sizeof(method) && memcmp(method, "HEAD ", sizeof(method))==0;
+    // uploads are handled while parsing, they already see the number
+    requests++;
+
+    if(_parseRequest(_currentClient)){
+        _contentLength=CONTENT_LENGTH_NOT_SET;
+        // HTTP/1.1 keeps the connection unless told otherwise, 1.0 only if asked to
+        String connection=header("Connection");
+        connection.toLowerCase();
+        if(_currentVersion==0 ? connection!="keep-alive" : connection=="close") keep_alive=false;
+        if(c.requests>0) reused++;
+        c.requests++;
+        last_code=0;
+        unsigned long before=bytes_sent;
+        _handleRequest();
+        // a handler that answered nothing would leave the client waiting
+        // for a response that never comes on this connection
+        if(last_code==0){
+            if(bytes_sent==before) send(500, "text/plain", "No response");
+            else keep_alive=false;
+        }
+    }else{
+        // there is no telling where the next request would start
+        keep_alive=false;
+    }
+
+    _currentUpload.reset();
+    _currentClient=WiFiClient();
+    _currentStatus=HC_NONE;
+    c.waiting=0;
+    c.last=millis();
+    if(!keep_alive || !c.tcp.connected()) drop(c);
+}
+
+
+void LHWebServer::drop(Connection &c){
+    c.tcp.stop();
+    c.tcp=WiFiClient();
+    c.waiting=0;
+}
+
+
+void LHWebServer::close(){
+    for(uint8_t i=0; i<HTTP_CLIENTS; i++){
+        if(clients[i].tcp) drop(clients[i]);
+    }
+    ESP8266WebServer::close();
+}
+
+
+uint8_t LHWebServer::connected(){
+    uint8_t n=0;
+    for(uint8_t i=0; i<HTTP_CLIENTS; i++){
+        if(clients[i].tcp && clients[i].tcp.connected()) n++;
+    }
+    return n;
+}
+
+
+// like ESP8266WebServer::_prepareHeader(), but with keep-alive
+void LHWebServer::prepareHeader(String& response, int code, const char* content_type, size_t content_length){
+    response=(String)"HTTP/1."+_currentVersion+" "+code+" "+_responseCodeToString(code)+"\r\n";
+    response+=(String)"Content-Type: "+(content_type ? content_type : "text/html")+"\r\n";
+    if(_contentLength!=CONTENT_LENGTH_NOT_SET) content_length=_contentLength;
+    if(content_length!=CONTENT_LENGTH_UNKNOWN){
+        response+=(String)"Content-Length: "+content_length+"\r\n";
+    }else if(_currentVersion){
+        // a HEAD response has no body, not even the last chunk
+        _chunked=!head;
+        response+="Transfer-Encoding: chunked\r\n";
+    }else{
+        // a HTTP/1.0 client only sees the end of the body when we close
+        keep_alive=false;
+    }
+    response+= keep_alive ? "Connection: keep-alive\r\n" : "Connection: close\r\n";
+    response+=_responseHeaders;
+    response+="\r\n";
+    _responseHeaders="";
+}
+
+
+void LHWebServer::sendHeader(const String& name, const String& value, bool first){
+    if(name.equalsIgnoreCase("Connection")){
+        if(value.equalsIgnoreCase("close")) keep_alive=false;
+        return;
+    }
+    ESP8266WebServer::sendHeader(name, value, first);
+}
+
+
+void LHWebServer::send(int code, const char* content_type, const String& content){
+    last_code=code;
+    String header;
+    prepareHeader(header, code, content_type, content.length());
+    _currentClient.write(header.c_str(), header.length());
+    if(content.length()>0) sendContent(content);
+}
+
+void LHWebServer::send(int code, char* content_type, const String& content){
+    send(code, (const char*)content_type, content);
+}
+
+void LHWebServer::send(int code, const String& content_type, const String& content){
+    send(code, content_type.c_str(), content);
+}
+
+void LHWebServer::sendContent(const String& content){
+    if(head) return;
+    bytes_sent+=content.length();
+    ESP8266WebServer::sendContent(content);
+}
+
+void LHWebServer::sendContent(const char* content, size_t len){
+    if(len==0 || head) return;
+    if(_chunked){
+        char chunk_size[12];
+        sprintf(chunk_size, "%x\r\n", (unsigned int)len);
+        _currentClient.write(chunk_size, strlen(chunk_size));
+    }
+    _currentClient.write(content, len);
+    if(_chunked){
+        _currentClient.write("\r\n", 2);
+    }
+    bytes_sent+=len;
+}
+
+
 // Constructor - inits config and web server as well
-LHWeb::LHWeb(bool dbg): config("lhweb.conf"), httpd(80), telnetd(23){
+LHWeb::LHWeb(bool dbg): config("lhweb.conf"), httpd(80), telnetd(23), websocket(81){
     debug=dbg;
+    memcpy(cache_max_age, default_max_age, sizeof(cache_max_age));
+    memcpy(rate_per_minute, default_rate_per_minute, sizeof(rate_per_minute));
+    memcpy(rate_burst, default_rate_burst, sizeof(rate_burst));
+    memset(rate_buckets, 0, sizeof(rate_buckets));
     readMacAddress();
     // set defaults
     fallback_ssid="LHWeb_"+short_mac;
@@ -13,6 +383,25 @@ LHWeb::LHWeb(bool dbg): config("lhweb.conf"), httpd(80), telnetd(23){
     fallback_pass.trim();
     
     telnet_commands = LinkedList<TelnetCmd*>();
+
+    profile_template=profileSlot("parseTemplate");
+    profile_config=profileSlot("config.save");
+    profile_log=profileSlot("addLog");
+    profile_command=profileSlot("processCommand");
+    profile_journal=profileSlot("config.journal");
+    last_stall.duration=0;
+    memset(&metrics, 0, sizeof(Metrics));
+
+    // built-in tasks, in the order the work used to be done
+    addTask("ntp",    [&](){ this->handleNtp(); },    10, 100, 2000);
+    addTask("wifi",   [&](){ this->handleWifi(); },   20, 500, 2000);
+    addTask("http",   [&](){ if(WiFi.status()!=WL_CONNECTION_LOST) this->httpd.handleClient(); }, 30, 2, 10000);
+    addTask("serial", [&](){ this->handleSerial(); }, 40, 20, 2000);
+    addTask("telnet", [&](){ this->handleTelnet(); }, 50, 10, 5000);
+    addTask("websocket", [&](){ this->websocket.handle(); }, 55, 10, 5000);
+    addTask("announce", [&](){ this->handleAnnounce(); }, 58, 10, 2000);
+    addTask("timer",  [&](){ this->handleTimer(); },  60, 10, 2000);
+    addTask("config", [&](){ this->handleConfig(); }, 65, 100, 20000);
 }
 
 void LHWeb::begin(){
@@ -22,26 +411,63 @@ void LHWeb::begin(){
     // read config file
     if(debug) Serial.print("Loading config ");
     if(debug) Serial.println(config.begin());
+    replayJournal();
+
+    // cache lifetime of static files, eg http_cache_css 3600
+    for(uint8_t i=1; i<MIME_COUNT; i++){
+        String key=(String)"http_cache_"+(mime_extensions[i]+1);
+        if(config.exists(key)) cache_max_age[i]=config.get(key).toInt();
+    }
+    if(config.exists("http_compress")) compress_pages=config.get("http_compress")!="0";
+
+    // rate limits per route class, eg rate_dynamic "120 10"
+    for(uint8_t i=0; i<RATE_CLASSES; i++){
+        String key=(String)"rate_"+rate_class_names[i];
+        if(!config.exists(key)) continue;
+        String val=config.get(key);
+        int sep=val.indexOf(' ');
+        setRateLimit(i, val.toInt(), sep>0 ? val.substring(sep+1).toInt() : rate_burst[i]);
+    }
+
+    // multicast announcements, eg announce_group 239.255.76.72
+    if(config.exists("announce_group")){
+        announce_group.fromString(config.get("announce_group").c_str());
+        if(config.exists("announce_port")) announce_port=config.get("announce_port").toInt();
+        if(config.exists("announce_interval") && config.get("announce_interval").toInt()>0){
+            announce_interval=config.get("announce_interval").toInt()*1000UL;
+        }
+    }
+    // first heartbeat as soon as the wifi is up
+    announce_heartbeat=millis()-announce_interval;
 
     // open UDP Port dor ntp
     Udp.begin(localUdpPort);
     
     // assign default page handlers
-    httpd.onNotFound ( [&](){ this->handle404(); } );
-    httpd.on ( "/",  [&](){ this->handleRoot(); }  );
-    httpd.on ( "/userconfig",  [&](){ this->handleUserConfig(); }  );
-    httpd.on ( "/reset",  [&](){ this->handleReset(); } );
+    httpd.collectHeaders(request_headers, sizeof(request_headers)/sizeof(request_headers[0]));
+    httpd.onNotFound ( profiled("onNotFound", [&](){ this->handle404(); }, RATE_STATIC) );
+    httpd.on ( "/",  profiled("/", [&](){ this->handleRoot(); })  );
+    httpd.on ( "/userconfig",  profiled("/userconfig", [&](){ this->handleUserConfig(); })  );
+    httpd.on ( "/reset",  profiled("/reset", [&](){ this->handleReset(); }, RATE_CONTROL) );
     
-    httpd.onFileUpload([&](){ this->fileUpload(); } ); // curl -F "file=@css/dropdown.css;filename=/css/dropdown.css" 192.168.4.1/upload
-    httpd.on("/upload", HTTP_POST, [&](){ this->onUpload(); } );
-    httpd.on("/browse", [&](){ this->handleBrowse(); } );
-    httpd.on("/webconfig", [&](){ this->handleWebConfig(); } );
-    httpd.on("/showlog", [&](){ this->handleLog(); } );
-    httpd.on("/format", [&](){ this->handleFormat(); } );
+    // uploads are limited once per request in fileUpload()
+    httpd.onFileUpload(profiled("fileUpload", [&](){ this->fileUpload(); }, RATE_NONE) ); // curl -F "file=@css/dropdown.css;filename=/css/dropdown.css" 192.168.4.1/upload
+    httpd.on("/upload", HTTP_POST, profiled("/upload", [&](){ this->onUpload(); }, RATE_NONE) );
+    httpd.on("/deploy", HTTP_POST, profiled("/deploy", [&](){ this->onDeploy(); }, RATE_NONE) ); // curl -F "file=@bundle.tar" 192.168.4.1/deploy
+    httpd.on("/browse", profiled("/browse", [&](){ this->handleBrowse(); }) );
+    httpd.on("/webconfig", profiled("/webconfig", [&](){ this->handleWebConfig(); }) );
+    httpd.on("/showlog", profiled("/showlog", [&](){ this->handleLog(); }) );
+    httpd.on("/format", profiled("/format", [&](){ this->handleFormat(); }, RATE_CONTROL) );
+    httpd.on("/stats", profiled("/stats", [&](){ this->handleStats(); }) );
+    httpd.on("/metrics", profiled("/metrics", [&](){ this->handleMetrics(); }) );
+    httpd.on("/manifest", profiled("/manifest", [&](){ this->handleManifest(); }) );
+    router.on("/channel/{ch}/{cmd}", profiled("/channel", [&](){ this->handleChannel(); }, RATE_CONTROL) );
+    httpd.addHandler(new LHRouterHandler(router));
     
     
-    checkFiles();
+    indexAssets();
     
+    loadWifiCache();
     connect();
     
     // start web server
@@ -50,49 +476,22 @@ void LHWeb::begin(){
     // start telnet server
     telnetd.begin();
     telnetd.setNoDelay(true);
-}
 
-
-
-void LHWeb::checkFiles(){
-    if(!SPIFFS.exists("/index.tmpl")){
-        fsUploadFile = SPIFFS.open("/index.tmpl", "w");
-        fsUploadFile.println("<html>\
-        <head>\
-          <meta name=\"viewport\" content=\"width=device-width, initial-scale=1\">\
-        </head>\
-        <body>\
-          <form method=\"POST\" action=\"/webconfig\">\
-            <table>\
-              <tr><td>SSID:</td><td><input name=\"wifi_ssid\"></td></tr>\
-              <tr><td>Passwort:</td><td><input name=\"wifi_pass\"></td></tr>\
-              <tr><td>Hostname:</td><td><input name=\"wifi_host\"></td></tr>\
-              <tr><td colspan=2><input type=\"submit\" value=\"Save\"></td></tr>\
-            </table>\
-          </form>\
-        </body></html>");
-        fsUploadFile.close();
-    }
-    if(!SPIFFS.exists("/webconfig.tmpl")){
-        fsUploadFile = SPIFFS.open("/webconfig.tmpl", "w");
-        fsUploadFile.println("<html>\
-        <head>\
-          <meta name=\"viewport\" content=\"width=device-width, initial-scale=1\">\
-        </head>\
-        <body>\
-          {{banner}}\
-          Aktuelle WLAN-Daten:<br>\
-            <table>\
-              <tr><td>SSID:</td><td>{{ssid}}</td></tr>\
-              <tr><td>Passwort:</td><td>{{pass}}</td></tr>\
-              <tr><td>Hostname:</td><td>{{host}}</td></tr>\
-            </table>\
-        </body></html>");
-        fsUploadFile.close();
-    }
+    // start websocket server, it takes the same commands as telnet
+    websocket.onMessage([&](uint8_t client, const String& message){
+        if(!admit(websocket.remoteIP(client), RATE_CONTROL)){
+            websocket.send(client, "ERROR rate limited\n");
+            return;
+        }
+        String str=message;
+        str.trim();
+        websocket.send(client, processInput(str));
+    });
+    websocket.begin();
 }
 
 
+
 String LHWeb::SSID(){
     //return "Speedlink-493";
     if(config.exists("wifi_ssid")){
@@ -102,7 +501,7 @@ String LHWeb::SSID(){
     }
 }
 void LHWeb::SSID(String ssid){
-    config.add("wifi_ssid", ssid);
+    setConfig("wifi_ssid", ssid);
 }
 
 String LHWeb::Password(){
@@ -114,7 +513,7 @@ String LHWeb::Password(){
     }
   }
 void LHWeb::Password(String pass){
-    config.add("wifi_pass", pass);
+    setConfig("wifi_pass", pass);
 }
 
 String LHWeb::Hostname(){
@@ -125,7 +524,7 @@ String LHWeb::Hostname(){
     }
 }
 void LHWeb::Hostname(String hostname){
-    config.add("wifi_hostname", hostname);
+    setConfig("wifi_hostname", hostname);
 }
 
 String LHWeb::NTPServer(){
@@ -136,7 +535,7 @@ String LHWeb::NTPServer(){
     }
 }
 void LHWeb::NTPServer(String ntp){
-    config.add("wifi_ntp", ntp);
+    setConfig("wifi_ntp", ntp);
 }
 
 int LHWeb::TimeZone(){
@@ -147,7 +546,7 @@ int LHWeb::TimeZone(){
     }
 }
 void LHWeb::TimeZone(int tz){
-    config.add("wifi_tz", (String)tz);
+    setConfig("wifi_tz", (String)tz);
 }
 
 // Read MAC address and store in varialbles (mac_address and short_mac)
@@ -172,6 +571,7 @@ void LHWeb::readMacAddress(){
 void LHWeb::connect(bool fallback_AP){
     char ssid[100]; SSID().toCharArray(ssid, 100);
     char pass[100]; Password().toCharArray(pass, 100);
+    unsigned long start=millis();
 
     WiFi.disconnect();
     WiFi.softAPdisconnect(false);
@@ -180,19 +580,53 @@ void LHWeb::connect(bool fallback_AP){
     if(debug) Serial.print("Password: '");
     if(debug) Serial.print(pass);
     if(debug) Serial.println("'");
-    WiFi.begin ( ssid, pass );
-    delay(100);
-    WiFi.mode(WIFI_STA);
-    delay(100);
-    int counter=0;
-    while ( WiFi.status() != WL_CONNECTED && WiFi.status() != WL_NO_SSID_AVAIL && counter++<100 ) {
-        delay ( 200 );
-        if(debug) Serial.print ( "." );
+
+    // static address from the config, or the cached lease if wifi_static is 1
+    IPAddress ip, gateway, mask, dns;
+    bool cached_lease=false;
+    if(config.exists("wifi_ip") && ip.fromString(config.get("wifi_ip").c_str())){
+        gateway.fromString(config.get("wifi_gateway").c_str());
+        mask.fromString(config.get("wifi_mask").c_str());
+        dns.fromString(config.get("wifi_dns").c_str());
+    }else if(config.get("wifi_static")=="1" && wifi_cached && wifi_cache.network==networkHash()){
+        ip=wifi_cache.ip;
+        gateway=wifi_cache.gateway;
+        mask=wifi_cache.mask;
+        dns=wifi_cache.dns;
+        cached_lease=true;
+    }
+    if((uint32_t)ip!=0) WiFi.config(ip, gateway, mask, dns);
+
+    // directed connect to the AP that worked last time, no scan
+    bool connected=false;
+    if(wifi_cached && wifi_cache.network==networkHash()){
+        WiFi.mode(WIFI_STA);
+        WiFi.begin(ssid, pass, wifi_cache.channel, wifi_cache.bssid);
+        connected=waitForWifi(WIFI_FAST_TRIES);
+        if(connected){
+            metrics.wifi_fast_connects++;
+        }else{
+            addLog("Cached AP not reachable, scanning", false);
+            WiFi.disconnect();
+            // the lease may be stale as well, back to DHCP
+            if(cached_lease) WiFi.config(0U, 0U, 0U);
+            delay(100);
+        }
+    }
+
+    if(!connected){
+        WiFi.begin ( ssid, pass );
+        delay(100);
+        WiFi.mode(WIFI_STA);
+        delay(100);
+        connected=waitForWifi(100);
     }
-    if(debug) Serial.println ( );
     
-    if( WiFi.status() == WL_CONNECTED ){
+    if( connected ){
         addLog("connected to wifi", false);
+        metrics.wifi_connect_ms=millis()-start;
+        if(metrics.wifi_boot_ms==0) metrics.wifi_boot_ms=millis();
+        saveWifiCache();
 
         // register at DNS
         char host[100]; Hostname().toCharArray(host, 100);
@@ -211,7 +645,7 @@ void LHWeb::connect(bool fallback_AP){
       
         // Start time sync
         //setSyncProvider( (time_t(*)()) &LHWeb::getNtpTime);
-        setTime(getNtpTime());
+        syncTime(getNtpTime());
         last_time_sync=millis();
       
 
@@ -225,6 +659,60 @@ void LHWeb::connect(bool fallback_AP){
 }
 
 
+// polls the connection state every 200ms
+bool LHWeb::waitForWifi(int tries){
+    int counter=0;
+    while ( WiFi.status() != WL_CONNECTED && WiFi.status() != WL_NO_SSID_AVAIL && counter++<tries ) {
+        delay ( 200 );
+        if(debug) Serial.print ( "." );
+    }
+    if(debug) Serial.println ( );
+    return WiFi.status() == WL_CONNECTED;
+}
+
+
+// the cache is only valid for the network it was written for
+uint32_t LHWeb::networkHash(){
+    String ssid=SSID();
+    String pass=Password();
+    uint32_t crc=crc32(0, (const uint8_t*)ssid.c_str(), ssid.length()+1);
+    return crc32(crc, (const uint8_t*)pass.c_str(), pass.length());
+}
+
+
+void LHWeb::loadWifiCache(){
+    wifi_cached=false;
+    File file=SPIFFS.open(WIFI_CACHE, "r");
+    if(!file) return;
+    bool complete= file.read((uint8_t*)&wifi_cache, sizeof(wifi_cache))==sizeof(wifi_cache);
+    file.close();
+    wifi_cached= complete && wifi_cache.crc==crc32(0, (const uint8_t*)&wifi_cache, offsetof(WifiCache, crc));
+}
+
+
+// writes the cache only if something changed, to spare the flash
+void LHWeb::saveWifiCache(){
+    WifiCache cache;
+    memset(&cache, 0, sizeof(cache));
+    cache.network=networkHash();
+    memcpy(cache.bssid, WiFi.BSSID(), sizeof(cache.bssid));
+    cache.channel=WiFi.channel();
+    cache.ip=WiFi.localIP();
+    cache.gateway=WiFi.gatewayIP();
+    cache.mask=WiFi.subnetMask();
+    cache.dns=WiFi.dnsIP();
+    cache.crc=crc32(0, (const uint8_t*)&cache, offsetof(WifiCache, crc));
+    if(wifi_cached && memcmp(&cache, &wifi_cache, sizeof(cache))==0) return;
+
+    File file=SPIFFS.open(WIFI_CACHE, "w");
+    if(!file) return;
+    file.write((const uint8_t*)&cache, sizeof(cache));
+    file.close();
+    wifi_cache=cache;
+    wifi_cached=true;
+}
+
+
 // Writes general info to serial port
 void LHWeb::dumpConnectionInfo(){
     if(!debug){ return; }
@@ -278,6 +766,7 @@ void LHWeb::startAP(){
 // tries to reconnect to the wifi network
 // when it was called 5 times without success, an AP will be started
 void LHWeb::reconnect(){
+    metrics.wifi_reconnects++;
     if(tries_reconnect++ >5){
         //startAP();
     }else{
@@ -309,6 +798,12 @@ String LHWeb::processCommand(String cmd, String key, String val, String par){
         ret+="?       wifi_hostname - name of the ESP module\n";
         ret+="?       wifi_ntp - Name of NTP server\n";
         ret+="?       wifi_tz - Time zone (offset in hours)\n";
+        ret+="?       wifi_ip, wifi_gateway, wifi_mask, wifi_dns - static address instead of DHCP\n";
+        ret+="?       wifi_static - 1 keeps the last DHCP lease as static address\n";
+        ret+="?       announce_group - multicast address for state and heartbeat datagrams, eg 239.255.76.72 (after reset)\n";
+        ret+="?       announce_port, announce_interval - port (4210) and seconds between heartbeats (30)\n";
+        ret+="?       rate_static, rate_dynamic, rate_upload, rate_control - \"<per minute> <burst>\" per address, 0 = no limit (after reset)\n";
+        ret+="?   commit - writes pending config changes to flash right away\n";
         ret+="?   reset - Restarts the ESP module\n";
         ret+="?   set - set state of device/channel\n";       
         ret+="?     usage: set <channel> <state>\n";        
@@ -319,6 +814,12 @@ String LHWeb::processCommand(String cmd, String key, String val, String par){
         ret+="?       example: channel 0\n";
         ret+="?       example: channel\n";
         ret+="?   rssi - shows wifi quality\n";
+        ret+="?   stats - shows run time histograms and stalls of the main loop\n";
+        ret+="?     usage: stats [reset]\n";
+        ret+="?   heap - shows heap usage\n";
+#ifdef LHWEB_BENCHMARK
+        ret+="?   bench - runs the benchmarks (blocks for a few seconds)\n";
+#endif
         ret+="\n";
     }else if(cmd=="config"){
         if(key==""){
@@ -334,12 +835,15 @@ String LHWeb::processCommand(String cmd, String key, String val, String par){
                 }
             }                
         }else{
-            config.add(key, val);
-            config.save();
+            setConfig(key, val);
             ret+="OK\n";
         }
+    }else if(cmd=="commit"){
+        ret+= commitConfig() ? "OK\n" : "ERROR config not saved\n";
     }else if(cmd=="reset"){
-        system_restart();
+        // changes still waiting for CONFIG_QUIET would be lost
+        if(commitConfig()) system_restart();
+        ret="ERROR config not saved\n";
     }else if(cmd=="version"){
         ret="version ";
         ret+=VERSION;
@@ -348,15 +852,9 @@ String LHWeb::processCommand(String cmd, String key, String val, String par){
         if(val==""){
             ret="ERROR Parameter missing\n";
         }else{
-            bool found=false;
-            for(int i=0; i<telnet_commands.size(); i++){
-                TelnetCmd *tel=telnet_commands.get(i);
-                if(key==tel->channel && val==tel->command){
-                    tel->func();
-                    found=true;
-                }
-            }
-            if(found){
+            THandlerFunction *func=commands.find((key+"/"+val).c_str());
+            if(func){
+                (*func)();
                 ret="OK\n";
             }else{
                 ret="ERROR command not registered\n";
@@ -395,6 +893,19 @@ String LHWeb::processCommand(String cmd, String key, String val, String par){
         ret="rssi ";
         ret+=WiFi.RSSI();
         ret+="\n\n";
+    }else if(cmd=="stats"){
+        if(key=="reset"){
+            resetStats();
+            ret="OK\n";
+        }else{
+            ret=stats();
+        }
+    }else if(cmd=="heap"){
+        ret=heapStats();
+#ifdef LHWEB_BENCHMARK
+    }else if(cmd=="bench"){
+        ret=runBenchmarks();
+#endif
     }else{
         ret="ERROR unknown command\n";
     }
@@ -416,105 +927,625 @@ String LHWeb::processInput(String input){
     if(sep2<0) val="";
     if(sep1<0) key="";
 
-    return processCommand(cmd, key, val, par);
+    unsigned long start=micros();
+    HEAP_BEGIN();
+    String ret=processCommand(cmd, key, val, par);
+    HEAP_END(profile_command);
+    profileRecord(profile_command, micros()-start);
+    return ret;
 }
 
 // checks to see if we are still conencted to the wifi network
 // if conenction was lost it will try to reconnect
 // also handles all client requests.
-void LHWeb::doWork(){
-    unsigned long sync_interval=600000;
-    
-    // Check WIFI connection state
-    if(timeStatus()==timeNotSet || timeStatus()==timeNeedsSync){
-        sync_interval=30000;
+// Every due task runs once per pass. Once the pass budget is used up
+// the remaining due tasks are deferred and run first in the next pass,
+// so a slow stage can not starve the others.
+unsigned long LHWeb::doWork(){
+    unsigned long pass_start=micros();
+    uint16_t ran=0;
+
+    pass_task_us=0;
+    pass_handler=NULL;
+    pass_handler_us=0;
+
+    for(uint8_t round=0; round<2; round++){
+        for(uint8_t i=0; i<task_count; i++){
+            Task &task=tasks[i];
+            if( ran & (1<<i) ) continue;
+            if( round==0 && !task.deferred ) continue;
+            if( (long)(millis()-task.next_run)<0 ) continue;
+            if( round==1 && micros()-pass_start>pass_budget ){
+                task.deferred=true;
+                continue;
+            }
+            runTask(task);
+            ran |= 1<<i;
+        }
     }
-    if( millis()<last_time_sync || millis()-last_time_sync>sync_interval){
-        setTime(getNtpTime());
-        last_time_sync=millis();
+
+    unsigned long pass_time=micros()-pass_start;
+    if(pass_time>stall_threshold) recordStall(pass_time);
+
+    // find the next deadline
+    unsigned long now=millis();
+    unsigned long wait=0xFFFFFFFF;
+    for(uint8_t i=0; i<task_count; i++){
+        long d=(long)(tasks[i].next_run-now);
+        if(d<=0 || tasks[i].deferred) return now;
+        if((unsigned long)d<wait) wait=d;
     }
-    
-    if(WiFi.status()==WL_CONNECTION_LOST){
-        addLog("connection lost", false);
-        reconnect();
-    }else{
-        httpd.handleClient();
+    return now+wait;
+}
+
+
+void LHWeb::runTask(Task &task){
+    current_task=&task;
+    task.deferred=false;
+    task_start=micros();
+    HEAP_BEGIN();
+    task.func();
+    HEAP_END(task.profile);
+    task.used=micros()-task_start;
+    if(task.used>task.budget) task.overruns++;
+    profileRecord(task.profile, task.used);
+    if(task.used>pass_task_us){
+        pass_task_us=task.used;
+        pass_task=task.name;
     }
+    task.next_run=millis()+task.interval;
+    current_task=NULL;
+}
 
-    // Handle Serial communication
-    if(debug){
-        while (Serial.available()) {
-            char inChar = (char)Serial.read();
-            //Serial.println(inChar);
-            if (inChar == '\n') {
-                serial_input_complete = true;
-            }else{
-                serial_input_string += inChar;
-            }
 
-        }
+bool LHWeb::taskBudgetLeft(){
+    if(current_task==NULL) return true;
+    return micros()-task_start < current_task->budget;
+}
 
-        if(serial_input_complete){         
-            serial_input_string.trim();
-            Serial.print(processInput(serial_input_string));
-            
-            serial_input_string="";
-            serial_input_complete=false;
-        }
+
+bool LHWeb::addTask(const char* name, THandlerFunction func, uint8_t priority, unsigned long interval, unsigned long budget){
+    if(task_count>=MAX_TASKS) return false;
+
+    // keep the table sorted by priority
+    uint8_t pos=task_count;
+    while(pos>0 && tasks[pos-1].priority>priority){
+        tasks[pos]=tasks[pos-1];
+        pos--;
     }
-    
-    
-    // Handle telnet communication    
-    uint8_t i;
-    if (telnetd.hasClient()){
-        for(i = 0; i < MAX_SRV_CLIENTS; i++){
-            if (!telnetClients[i] || !telnetClients[i].connected()){
-                if(telnetClients[i]) telnetClients[i].stop();
-                telnetClients[i] = telnetd.available();
-                continue;
-            }
+    Task &task=tasks[pos];
+    task.name=name;
+    task.func=func;
+    task.priority=priority;
+    task.interval=interval;
+    task.budget=budget;
+    task.next_run=millis();
+    task.used=0;
+    task.overruns=0;
+    task.deferred=false;
+    task.profile=profileSlot(name);
+    task_count++;
+    return true;
+}
+
+
+LHWeb::Task* LHWeb::getTask(const char* name){
+    for(uint8_t i=0; i<task_count; i++){
+        if(strcmp(tasks[i].name, name)==0) return &tasks[i];
+    }
+    return NULL;
+}
+
+void LHWeb::setTaskInterval(const char* name, unsigned long interval){
+    Task *task=getTask(name);
+    if(task) task->interval=interval;
+}
+
+void LHWeb::setTaskBudget(const char* name, unsigned long budget){
+    Task *task=getTask(name);
+    if(task) task->budget=budget;
+}
+
+void LHWeb::setPassBudget(unsigned long budget){
+    pass_budget=budget;
+}
+
+
+uint8_t LHWeb::profileSlot(const char* name){
+    for(uint8_t i=0; i<profile_count; i++){
+        if(strcmp(profiles[i].name, name)==0) return i;
+    }
+    // the last slot is shared by every name that did not get its own
+    if(profile_count>=MAX_PROFILES-1){
+        if(profile_count<MAX_PROFILES){
+            memset(&profiles[profile_count], 0, sizeof(Profile));
+            profiles[profile_count++].name="other";
         }
-        //no free spot
-        WiFiClient telnetClient = telnetd.available();
-        telnetClient.stop();
+        return MAX_PROFILES-1;
     }
-    for(i = 0; i < MAX_SRV_CLIENTS; i++){
-        if (telnetClients[i] && telnetClients[i].connected()){
-            if(telnetClients[i].available()){
-                String str="";
-                while(telnetClients[i].available()){
-                    str+=(char)telnetClients[i].read();
-                }
-                str.trim();
-                telnetClients[i].print(processInput(str));
-                delay(10);
+    Profile &p=profiles[profile_count];
+    memset(&p, 0, sizeof(Profile));
+    p.name=name;
+    return profile_count++;
+}
+
+
+// upper bounds of the histogram buckets in us, the last bucket is open
+static const unsigned long profile_bounds[PROFILE_BUCKETS-1]={
+    100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000
+};
+
+void LHWeb::profileRecord(uint8_t slot, unsigned long us){
+    Profile &p=profiles[slot];
+    uint8_t b=0;
+    while(b<PROFILE_BUCKETS-1 && us>=profile_bounds[b]) b++;
+    if(p.hist[b]<0xFFFF) p.hist[b]++;
+    p.count++;
+    p.total+=us;
+    if(us>p.max) p.max=us;
+}
+
+
+THandlerFunction LHWeb::profiled(const char* name, THandlerFunction func, uint8_t route_class){
+    uint8_t slot=profileSlot(name);
+    return [this, slot, func, route_class](){
+        unsigned long start=micros();
+        this->httpd.last_code=0;
+        HEAP_BEGIN();
+        // turned away before the handler does any work
+        bool http=this->current_task && strcmp(this->current_task->name, "http")==0;
+        if(http && route_class<RATE_CLASSES && !this->admitRequest(route_class)){
+            this->sendTooManyRequests();
+        }else{
+            func();
+        }
+        unsigned long us=micros()-start;
+        HEAP_END(slot);
+        this->profileRecord(slot, us);
+        int code=this->httpd.last_code;
+        if(code>=200 && code<600 && this->current_task && strcmp(this->current_task->name, "http")==0){
+            this->metrics.http_status[slot][code/100-2]++;
+        }
+        if(us>this->pass_handler_us){
+            this->pass_handler_us=us;
+            this->pass_handler=this->profiles[slot].name;
+            if(this->current_task && strcmp(this->current_task->name, "http")==0){
+                this->httpd.uri().toCharArray(this->pass_uri, sizeof(this->pass_uri));
+            }else{
+                strcpy(this->pass_uri, "-");
             }
         }
+    };
+}
+
+
+void LHWeb::setRateLimit(uint8_t route_class, uint16_t per_minute, uint16_t burst){
+    if(route_class>=RATE_CLASSES) return;
+    rate_per_minute[route_class]=per_minute;
+    rate_burst[route_class]=burst>0 ? burst : 1;
+}
+
+
+bool LHWeb::admit(uint32_t ip, uint8_t route_class){
+    if(rate_per_minute[route_class]==0) return true;
+    unsigned long now=millis();
+
+    RateBucket *bucket=NULL;
+    RateBucket *oldest=&rate_buckets[0];
+    for(uint8_t i=0; i<RATE_CLIENTS; i++){
+        if(rate_buckets[i].ip==ip){
+            bucket=&rate_buckets[i];
+            break;
+        }
+        if(now-rate_buckets[i].last > now-oldest->last) oldest=&rate_buckets[i];
+    }
+    if(bucket==NULL){
+        bucket=oldest;
+        bucket->ip=ip;
+        bucket->last=now;
+        for(uint8_t c=0; c<RATE_CLASSES; c++) bucket->tokens[c]=(uint32_t)rate_burst[c]*1000;
     }
 
-    
-    // process timer
-    if( timer_time>0 && timer_time<=millis() ){
-        timer_time=0;
-        timer_function();
+    // refill, after 10 minutes every bucket is full anyway
+    unsigned long elapsed=now-bucket->last;
+    if(elapsed>600000) elapsed=600000;
+    bucket->last=now;
+    for(uint8_t c=0; c<RATE_CLASSES; c++){
+        uint32_t max=(uint32_t)rate_burst[c]*1000;
+        bucket->tokens[c]+=(uint64_t)elapsed*rate_per_minute[c]/60;
+        if(bucket->tokens[c]>max) bucket->tokens[c]=max;
     }
-    
+
+    if(bucket->tokens[route_class]<1000){
+        metrics.rate_limited[route_class]++;
+        return false;
+    }
+    bucket->tokens[route_class]-=1000;
+    return true;
 }
 
 
+bool LHWeb::admitRequest(uint8_t route_class){
+    return admit(httpd.client().remoteIP(), route_class);
+}
 
-void LHWeb::broadcast(String msg){
-    if(debug) Serial.println(msg);
-    
-    for(uint8_t i = 0; i < MAX_SRV_CLIENTS; i++){
-        if (telnetClients[i] && telnetClients[i].connected()){
-            telnetClients[i].println(msg);
-        }
-    }    
+
+// no log entry, no template, as cheap as a response gets
+void LHWeb::sendTooManyRequests(){
+    httpd.sendHeader("Retry-After", "1");
+    httpd.send(429, "text/plain", "Too Many Requests");
 }
 
 
-// callback function for time synchronization
+void LHWeb::setStallThreshold(unsigned long us){
+    stall_threshold=us;
+}
+
+
+void LHWeb::recordStall(unsigned long duration){
+    stall_count++;
+    last_stall.when=millis();
+    last_stall.duration=duration;
+    last_stall.task=pass_task;
+    last_stall.handler=pass_handler;
+    if(pass_handler){
+        strcpy(last_stall.uri, pass_uri);
+    }else{
+        strcpy(last_stall.uri, "-");
+    }
+    addLog((String)"Stall "+String(duration/1000)+"ms in "+(pass_task?pass_task:"-")+" "+(pass_handler?pass_handler:"-")+" "+last_stall.uri, false);
+}
+
+
+// one line per stage or handler:
+// stats <name> count=<n> avg=<us> max=<us> hist=<n>,<n>,...
+String LHWeb::stats(){
+    String ret="stats buckets";
+    char sep=' ';
+    for(uint8_t b=0; b<PROFILE_BUCKETS-1; b++){
+        ret+=sep;
+        ret+=profile_bounds[b];
+        sep=',';
+    }
+    ret+="\n";
+
+    for(uint8_t i=0; i<profile_count; i++){
+        Profile &p=profiles[i];
+        ret+="stats ";
+        ret+=p.name;
+        ret+=" count=";
+        ret+=p.count;
+        ret+=" avg=";
+        ret+=p.count>0 ? p.total/p.count : 0;
+        ret+=" max=";
+        ret+=p.max;
+        ret+=" hist=";
+        for(uint8_t b=0; b<PROFILE_BUCKETS; b++){
+            if(b>0) ret+=",";
+            ret+=p.hist[b];
+        }
+        ret+="\n";
+    }
+
+    ret+="stall count=";
+    ret+=stall_count;
+    ret+=" threshold=";
+    ret+=stall_threshold;
+    if(last_stall.duration>0){
+        ret+=" last=";
+        ret+=last_stall.duration;
+        ret+=" age=";
+        ret+=(millis()-last_stall.when)/1000;
+        ret+=" task=";
+        ret+=last_stall.task ? last_stall.task : "-";
+        ret+=" handler=";
+        ret+=last_stall.handler ? last_stall.handler : "-";
+        ret+=" uri=";
+        ret+=last_stall.uri;
+    }
+    ret+="\n";
+    return ret;
+}
+
+
+// heap <name> live=<bytes> allocs=<n> peak=<bytes> last=<bytes>
+String LHWeb::heapStats(){
+    String ret="heap free=";
+    ret+=ESP.getFreeHeap();
+    ret+=" max_block=";
+    ret+=ESP.getMaxFreeBlockSize();
+    ret+=" fragmentation=";
+    ret+=ESP.getHeapFragmentation();
+#ifdef LHWEB_HEAP_TRACKING
+    ret+=" min_free=";
+    ret+=heap_min_free;
+    ret+=" min_block=";
+    ret+=heap_min_block;
+    ret+="\n";
+    for(uint8_t i=0; i<profile_count; i++){
+        HeapProfile &h=heap_profiles[i];
+        if(h.allocs==0 && h.live==0) continue;
+        ret+="heap ";
+        ret+=profiles[i].name;
+        ret+=" live=";
+        ret+=h.live;
+        ret+=" allocs=";
+        ret+=h.allocs;
+        ret+=" peak=";
+        ret+=h.peak;
+        ret+=" last=";
+        ret+=h.last;
+        ret+="\n";
+    }
+#else
+    ret+="\n";
+#endif
+    return ret;
+}
+
+
+#ifdef LHWEB_HEAP_TRACKING
+// before is the free heap when the tracked code started
+void LHWeb::heapRecord(uint8_t slot, uint32_t before){
+    uint32_t after=ESP.getFreeHeap();
+    long delta=(long)before-(long)after;
+    HeapProfile &h=heap_profiles[slot];
+    h.last=delta;
+    h.live+=delta;
+    if(delta>0){
+        h.allocs++;
+        if(delta>h.peak) h.peak=delta;
+    }
+    if(after<heap_min_free) heap_min_free=after;
+    uint32_t block=ESP.getMaxFreeBlockSize();
+    if(block<heap_min_block) heap_min_block=block;
+}
+#endif
+
+
+void LHWeb::resetStats(){
+    for(uint8_t i=0; i<profile_count; i++){
+        const char* name=profiles[i].name;
+        memset(&profiles[i], 0, sizeof(Profile));
+        profiles[i].name=name;
+    }
+#ifdef LHWEB_HEAP_TRACKING
+    memset(heap_profiles, 0, sizeof(heap_profiles));
+    heap_min_free=0xFFFFFFFF;
+    heap_min_block=0xFFFFFFFF;
+#endif
+    stall_count=0;
+    last_stall.duration=0;
+}
+
+
+void LHWeb::handleStats(){
+    if(httpd.hasArg("reset")) resetStats();
+    httpd.send(200, "text/plain", stats()+heapStats());
+}
+
+
+// appends a formatted line to buf, the buffer is sent
+// to the client whenever the next line does not fit anymore
+void LHWeb::metricsPrintf(char* buf, size_t &len, const char* fmt, ...){
+    va_list args;
+    for(uint8_t tries=0; tries<2; tries++){
+        va_start(args, fmt);
+        int n=vsnprintf(buf+len, METRICS_BUFFER-len, fmt, args);
+        va_end(args);
+        if(n>=0 && len+n<METRICS_BUFFER){
+            len+=n;
+            return;
+        }
+        httpd.sendContent(buf, len);
+        len=0;
+    }
+}
+
+
+// Prometheus text exposition format
+void LHWeb::handleMetrics(){
+    char buf[METRICS_BUFFER];
+    size_t len=0;
+
+    httpd.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    httpd.send(200, "text/plain; version=0.0.4", "");
+
+    metricsPrintf(buf, len, "# TYPE lhweb_http_requests_total counter\n");
+    for(uint8_t i=0; i<profile_count; i++){
+        for(uint8_t c=0; c<4; c++){
+            if(metrics.http_status[i][c]==0) continue;
+            metricsPrintf(buf, len, "lhweb_http_requests_total{route=\"%s\",code=\"%dxx\"} %lu\n",
+                profiles[i].name, c+2, metrics.http_status[i][c]);
+        }
+    }
+    metricsPrintf(buf, len, "# TYPE lhweb_http_response_bytes_total counter\nlhweb_http_response_bytes_total %lu\n", httpd.bytes_sent);
+    metricsPrintf(buf, len, "# TYPE lhweb_http_connections_total counter\nlhweb_http_connections_total %lu\n", httpd.connections);
+    metricsPrintf(buf, len, "# TYPE lhweb_http_reused_requests_total counter\nlhweb_http_reused_requests_total %lu\n", httpd.reused);
+    metricsPrintf(buf, len, "# TYPE lhweb_http_clients gauge\nlhweb_http_clients %d\n", httpd.connected());
+    metricsPrintf(buf, len, "# TYPE lhweb_telnet_sessions_total counter\nlhweb_telnet_sessions_total %lu\n", metrics.telnet_sessions);
+    metricsPrintf(buf, len, "# TYPE lhweb_telnet_commands_total counter\nlhweb_telnet_commands_total %lu\n", metrics.telnet_commands);
+    metricsPrintf(buf, len, "# TYPE lhweb_websocket_sessions_total counter\nlhweb_websocket_sessions_total %lu\n", websocket.sessions);
+    metricsPrintf(buf, len, "# TYPE lhweb_websocket_messages_total counter\nlhweb_websocket_messages_total %lu\n", websocket.messages);
+    metricsPrintf(buf, len, "# TYPE lhweb_websocket_dropped_total counter\nlhweb_websocket_dropped_total %lu\n", websocket.dropped);
+    metricsPrintf(buf, len, "# TYPE lhweb_websocket_clients gauge\nlhweb_websocket_clients %d\n", websocket.connected());
+    metricsPrintf(buf, len, "# TYPE lhweb_announcements_total counter\nlhweb_announcements_total %lu\n", metrics.announcements);
+    metricsPrintf(buf, len, "# TYPE lhweb_ntp_syncs_total counter\nlhweb_ntp_syncs_total %lu\n", metrics.ntp_syncs);
+    metricsPrintf(buf, len, "# TYPE lhweb_ntp_failures_total counter\nlhweb_ntp_failures_total %lu\n", metrics.ntp_failures);
+    metricsPrintf(buf, len, "# TYPE lhweb_ntp_offset_seconds gauge\nlhweb_ntp_offset_seconds %ld\n", metrics.ntp_offset);
+    metricsPrintf(buf, len, "# TYPE lhweb_wifi_reconnects_total counter\nlhweb_wifi_reconnects_total %lu\n", metrics.wifi_reconnects);
+    metricsPrintf(buf, len, "# TYPE lhweb_wifi_rssi_dbm gauge\nlhweb_wifi_rssi_dbm %d\n", WiFi.RSSI());
+    metricsPrintf(buf, len, "# TYPE lhweb_wifi_boot_connected_ms gauge\nlhweb_wifi_boot_connected_ms %lu\n", metrics.wifi_boot_ms);
+    metricsPrintf(buf, len, "# TYPE lhweb_wifi_connect_ms gauge\nlhweb_wifi_connect_ms %lu\n", metrics.wifi_connect_ms);
+    metricsPrintf(buf, len, "# TYPE lhweb_wifi_fast_connects_total counter\nlhweb_wifi_fast_connects_total %lu\n", metrics.wifi_fast_connects);
+    metricsPrintf(buf, len, "# TYPE lhweb_config_commits_total counter\nlhweb_config_commits_total %lu\n", metrics.config_commits);
+    metricsPrintf(buf, len, "# TYPE lhweb_config_snapshots_total counter\nlhweb_config_snapshots_total %lu\n", metrics.config_snapshots);
+    metricsPrintf(buf, len, "# TYPE lhweb_uploads_total counter\nlhweb_uploads_total %lu\n", metrics.uploads);
+    metricsPrintf(buf, len, "# TYPE lhweb_upload_failures_total counter\nlhweb_upload_failures_total %lu\n", metrics.upload_failures);
+    metricsPrintf(buf, len, "# TYPE lhweb_rate_limited_total counter\n");
+    for(uint8_t i=0; i<RATE_CLASSES; i++){
+        metricsPrintf(buf, len, "lhweb_rate_limited_total{class=\"%s\"} %lu\n", rate_class_names[i], metrics.rate_limited[i]);
+    }
+    metricsPrintf(buf, len, "# TYPE lhweb_upload_bytes_total counter\nlhweb_upload_bytes_total %lu\n", metrics.upload_bytes);
+    metricsPrintf(buf, len, "# TYPE lhweb_upload_rate_bytes gauge\nlhweb_upload_rate_bytes %lu\n", metrics.upload_rate);
+    metricsPrintf(buf, len, "# TYPE lhweb_log_dropped_total counter\nlhweb_log_dropped_total %lu\n", metrics.log_dropped);
+    metricsPrintf(buf, len, "# TYPE lhweb_stalls_total counter\nlhweb_stalls_total %lu\n", stall_count);
+    metricsPrintf(buf, len, "# TYPE lhweb_heap_free_bytes gauge\nlhweb_heap_free_bytes %u\n", ESP.getFreeHeap());
+    metricsPrintf(buf, len, "# TYPE lhweb_heap_max_block_bytes gauge\nlhweb_heap_max_block_bytes %u\n", ESP.getMaxFreeBlockSize());
+#ifdef LHWEB_HEAP_TRACKING
+    metricsPrintf(buf, len, "# TYPE lhweb_heap_min_free_bytes gauge\nlhweb_heap_min_free_bytes %u\n", heap_min_free);
+    metricsPrintf(buf, len, "# TYPE lhweb_heap_live_bytes gauge\n");
+    for(uint8_t i=0; i<profile_count; i++){
+        if(heap_profiles[i].allocs==0 && heap_profiles[i].live==0) continue;
+        metricsPrintf(buf, len, "lhweb_heap_live_bytes{tag=\"%s\"} %ld\n", profiles[i].name, heap_profiles[i].live);
+    }
+#endif
+    metricsPrintf(buf, len, "# TYPE lhweb_uptime_seconds counter\nlhweb_uptime_seconds %lu\n", millis()/1000);
+
+    httpd.sendContent(buf, len);
+    httpd.sendContent("");
+}
+
+
+// non-blocking time sync: the request is sent in one pass,
+// the answer is picked up in one of the following ones
+void LHWeb::handleNtp(){
+    if(ntp_request_time>0){
+        if(Udp.parsePacket() >= NTP_PACKET_SIZE){
+            addLog("Received NTP Response", false);
+            syncTime(parseNtpPacket());
+            ntp_request_time=0;
+        }else if(millis()-ntp_request_time > 1500){
+            addLog("No NTP Response", false);
+            syncTime(0);
+            ntp_request_time=0;
+        }
+        return;
+    }
+
+    unsigned long sync_interval=600000;
+    if(timeStatus()==timeNotSet || timeStatus()==timeNeedsSync){
+        sync_interval=30000;
+    }
+    if( millis()<last_time_sync || millis()-last_time_sync>sync_interval){
+        if(WiFi.status()!=WL_CONNECTED) return;
+        while (Udp.parsePacket() > 0) ; // discard any previously received packets
+        addLog("Transmit NTP Request", false);
+        sendNTPpacket();
+        ntp_request_time=millis() | 1;
+        last_time_sync=millis();
+    }
+}
+
+
+// sets the clock to a time received from the NTP server
+// 0 means the request failed
+void LHWeb::syncTime(time_t t){
+    if(t==0){
+        metrics.ntp_failures++;
+        return;
+    }
+    metrics.ntp_syncs++;
+    if(timeStatus()!=timeNotSet) metrics.ntp_offset=(long)(t-now());
+    setTime(t);
+}
+
+
+// Check WIFI connection state
+void LHWeb::handleWifi(){
+    if(WiFi.status()==WL_CONNECTION_LOST){
+        addLog("connection lost", false);
+        reconnect();
+    }
+}
+
+
+// Handle Serial communication
+void LHWeb::handleSerial(){
+    if(!debug) return;
+
+    while (Serial.available() && !serial_input_complete && taskBudgetLeft()) {
+        char inChar = (char)Serial.read();
+        if (inChar == '\n') {
+            serial_input_complete = true;
+        }else{
+            serial_input_string += inChar;
+        }
+    }
+
+    if(serial_input_complete){         
+        serial_input_string.trim();
+        Serial.print(processInput(serial_input_string));
+        
+        serial_input_string="";
+        serial_input_complete=false;
+    }
+}
+
+
+// Handle telnet communication    
+void LHWeb::handleTelnet(){
+    uint8_t i;
+    if (telnetd.hasClient()){
+        for(i = 0; i < MAX_SRV_CLIENTS; i++){
+            if (!telnetClients[i] || !telnetClients[i].connected()){
+                if(telnetClients[i]) telnetClients[i].stop();
+                telnetClients[i] = telnetd.available();
+                if(telnetClients[i]) metrics.telnet_sessions++;
+                continue;
+            }
+        }
+        //no free spot
+        WiFiClient telnetClient = telnetd.available();
+        telnetClient.stop();
+    }
+
+    // start where the last run ran out of time
+    for(uint8_t n = 0; n < MAX_SRV_CLIENTS && taskBudgetLeft(); n++){
+        i = telnet_next_client;
+        telnet_next_client = (telnet_next_client+1) % MAX_SRV_CLIENTS;
+        if (telnetClients[i] && telnetClients[i].connected()){
+            if(telnetClients[i].available()){
+                String str="";
+                while(telnetClients[i].available()){
+                    str+=(char)telnetClients[i].read();
+                }
+                str.trim();
+                if(!admit(telnetClients[i].remoteIP(), RATE_CONTROL)){
+                    telnetClients[i].print("ERROR rate limited\n");
+                    continue;
+                }
+                metrics.telnet_commands++;
+                telnetClients[i].print(processInput(str));
+                delay(10);
+            }
+        }
+    }
+}
+
+
+// process timer
+void LHWeb::handleTimer(){
+    if( timer_time>0 && timer_time<=millis() ){
+        timer_time=0;
+        timer_function();
+    }
+}
+
+
+
+void LHWeb::broadcast(String msg){
+    if(debug) Serial.println(msg);
+    
+    for(uint8_t i = 0; i < MAX_SRV_CLIENTS; i++){
+        if (telnetClients[i] && telnetClients[i].connected()){
+            telnetClients[i].println(msg);
+        }
+    }    
+}
+
+
+// callback function for time synchronization
 time_t LHWeb::getNtpTime(){
     while (Udp.parsePacket() > 0) ; // discard any previously received packets
     addLog("Transmit NTP Request", false);
@@ -524,20 +1555,25 @@ time_t LHWeb::getNtpTime(){
         int size = Udp.parsePacket();
         if (size >= NTP_PACKET_SIZE) {
             addLog("Received NTP Response", false);
-            Udp.read(packetBuffer, NTP_PACKET_SIZE);  // read packet into the buffer
-            unsigned long secsSince1900;
-            // convert four bytes starting at location 40 to a long integer
-            secsSince1900 =  (unsigned long)packetBuffer[40] << 24;
-            secsSince1900 |= (unsigned long)packetBuffer[41] << 16;
-            secsSince1900 |= (unsigned long)packetBuffer[42] << 8;
-            secsSince1900 |= (unsigned long)packetBuffer[43];
-            return secsSince1900 - 2208988800UL + TimeZone() * SECS_PER_HOUR;
+            return parseNtpPacket();
         }
     }
     addLog("No NTP Response", false);
     return 0; // return 0 if unable to get the time
 }
 
+// reads a received NTP packet and returns the local time
+time_t LHWeb::parseNtpPacket(){
+    Udp.read(packetBuffer, NTP_PACKET_SIZE);  // read packet into the buffer
+    unsigned long secsSince1900;
+    // convert four bytes starting at location 40 to a long integer
+    secsSince1900 =  (unsigned long)packetBuffer[40] << 24;
+    secsSince1900 |= (unsigned long)packetBuffer[41] << 16;
+    secsSince1900 |= (unsigned long)packetBuffer[42] << 8;
+    secsSince1900 |= (unsigned long)packetBuffer[43];
+    return secsSince1900 - 2208988800UL + TimeZone() * SECS_PER_HOUR;
+}
+
 // send an NTP request to the time server at the given address
 void LHWeb::sendNTPpacket(){
     IPAddress address;
@@ -569,15 +1605,25 @@ String LHWeb::timeStamp(){
   }
 
 void LHWeb::addLog(String entry, bool remote){
+    unsigned long start=micros();
+    HEAP_BEGIN();
     if(remote){
         IPAddress ip = httpd.client().remoteIP();
         entry=timeStamp()+" "+ip.toString()+" "+entry;    
     }else{
         entry=timeStamp()+" "+entry;      
     }
-    log.add(entry);
+    appendLog(entry);
+    websocket.broadcast("log", entry);
     if(debug) Serial.println(entry);
-    while(log.size()>100){ log.shift(); }
+    HEAP_END(profile_log);
+    profileRecord(profile_log, micros()-start);
+}
+
+
+void LHWeb::appendLog(const String& entry){
+    log.add(entry);
+    while(log.size()>100){ log.shift(); metrics.log_dropped++; }
 }
 
 
@@ -585,99 +1631,165 @@ void LHWeb::addLog(String entry, bool remote){
 void LHWeb::handle404(){
     String file_name=httpd.uri();
     //Serial.println(file_name);
-    if(SPIFFS.exists(file_name)){
+    const Asset *asset=lookupAsset(file_name);
+    File file;
+    LHFlashFile flash;
+    uint8_t mime=asset ? asset->mime : 0;
+
+    // prefer a precompressed <name>.gz, streamFile() adds the Content-Encoding
+    // ranges always refer to the plain file if there is one
+    bool download=httpd.hasArg("download");
+    bool ranged=httpd.header("Range").length()>0;
+    if( !download && (asset==NULL || ((asset->flags & ASSET_GZIP) && !ranged)) && acceptsGzip() ){
+        const Asset *gz=lookupAsset(file_name+".gz");
+        if(gz){
+            if(asset==NULL) mime=mimeType(file_name);
+            asset=gz;
+            file_name+=".gz";
+        }
+    }
+
+    if(asset){
+        // the CRC from the index is the ETag, every representation has its own
+        char etag[12];
+        sprintf(etag, "\"%08x\"", asset->crc);
+        httpd.sendHeader("ETag", etag);
+        httpd.sendHeader("Cache-Control", cacheControl(mime));
+        httpd.sendHeader("Vary", "Accept-Encoding");
+
+        String if_none_match=httpd.header("If-None-Match");
+        if( if_none_match.length()>0 && (if_none_match.indexOf(etag)>=0 || if_none_match=="*") ){
+            addLog( (String)"Not modified "+httpd.uri() , true);
+            httpd.send(304, mime_types[mime], "");
+            return;
+        }
+        if(asset->flags & ASSET_BUNDLE){
+            flash=openBundled(asset);
+        }else{
+            file = SPIFFS.open(file_name, "r");
+        }
+    }
+
+    if(file || flash){
         addLog( (String)"Access file "+httpd.uri() , true);
-        File file = SPIFFS.open(file_name, "r");
-        size_t sent = httpd.streamFile(file, getContentType(file_name));
+        const char* content_type=download ? "application/octet-stream" : mime_types[mime];
+        size_t size=file ? file.size() : flash.size();
+        size_t start, end;
+        int range=parseRange(httpd.header("Range"), size, start, end);
+        httpd.sendHeader("Accept-Ranges", "bytes");
+        if(range<0){
+            httpd.sendHeader("Content-Range", (String)"bytes */"+size);
+            httpd.send(416, "text/plain", "Range Not Satisfiable");
+        }else if(range>0){
+            if(!download && file_name.endsWith(".gz")) httpd.sendHeader("Content-Encoding", "gzip");
+            bool positioned= file ? file.seek(start, SeekSet) : flash.seek(start);
+            if(!positioned){
+                httpd.send(500, "text/plain", "Seek failed");
+            }else if(file){
+                streamRange(file, size, content_type, start, end);
+            }else{
+                streamRange(flash, size, content_type, start, end);
+            }
+        }else if(file){
+            httpd.streamFile(file, content_type);
+        }else{
+            httpd.streamFile(flash, content_type);
+        }
         file.close();
     }else{
         addLog( (String)"Error 404: "+httpd.uri() , true);
-        String message = "File Not Found\n\n";
-        message += "URI: ";
-        message += httpd.uri();
-        message += "\nMethod: ";
-        message += ( httpd.method() == HTTP_GET ) ? "GET" : "POST";
-        message += "\nArguments: ";
-        message += httpd.args();
-        message += "\n";
+        char buf[256];
+        LHWriter message(httpd, buf, sizeof(buf));
+        httpd.setContentLength(CONTENT_LENGTH_UNKNOWN);
+        httpd.send(404, "text/plain", "");
+
+        message.print("File Not Found\n\nURI: ");
+        message.print(httpd.uri());
+        message.print("\nMethod: ");
+        message.print( ( httpd.method() == HTTP_GET ) ? "GET" : "POST" );
+        message.print("\nArguments: ");
+        message.print(httpd.args());
+        message.print("\n");
         
         for ( uint8_t i = 0; i < httpd.args(); i++ ) {
-            message += " " + httpd.argName ( i ) + ": " + httpd.arg ( i ) + "\n";
+            message.print(" ");
+            message.print(httpd.argName(i));
+            message.print(": ");
+            message.print(httpd.arg(i));
+            message.print("\n");
         }
-    
-        httpd.send ( 404, "text/plain", message );
+        message.flush();
+        httpd.sendContent("");
     }
 }
 
 
 
-String LHWeb::parseTemplate(String html_file, LHConfig &data){
-    String out="";
-    String tag;
-    char c;
+// parses a single range of a "Range: bytes=" header
+// returns 1 for a valid range, -1 if it can not be satisfied and 0
+// if the header is missing, malformed or asks for several ranges,
+// which is answered with the whole file
+int LHWeb::parseRange(const String& header, size_t size, size_t &start, size_t &end){
+    if(!header.startsWith("bytes=")) return 0;
+    String spec=header.substring(6);
+    spec.trim();
+    int dash=spec.indexOf('-');
+    if(dash<0 || spec.indexOf(',')>=0) return 0;
+    for(unsigned int i=0; i<spec.length(); i++){
+        if(i!=(unsigned int)dash && (spec[i]<'0' || spec[i]>'9')) return 0;
+    }
 
-    // h - html
-    // o - 1st open curly
-    // s - space
-    // t - tag
-    // c - 1st closing curly
-    char state='h';
-    
-    if(!SPIFFS.exists(html_file)){ 
+    String first=spec.substring(0, dash);
+    String last=spec.substring(dash+1);
+    if(first.length()==0){
+        // suffix range, the last n bytes
+        if(last.length()==0) return 0;
+        size_t n=last.toInt();
+        if(n==0 || size==0) return -1;
+        start= n<size ? size-n : 0;
+        end=size-1;
+        return 1;
+    }
+    start=first.toInt();
+    end= last.length()>0 ? (size_t)last.toInt() : size-1;
+    if(end<start) return 0;
+    if(start>=size) return -1;
+    if(end>=size) end=size-1;
+    return 1;
+}
+
+
+// sends the bytes start..end of a file of the given size as
+// 206 Partial Content, in has to be positioned at start already
+void LHWeb::streamRange(Stream &in, size_t size, const char* content_type, size_t start, size_t end){
+    size_t left=end-start+1;
+    char content_range[48];
+    sprintf(content_range, "bytes %u-%u/%u", (unsigned int)start, (unsigned int)end, (unsigned int)size);
+    httpd.sendHeader("Content-Range", content_range);
+    httpd.setContentLength(left);
+    httpd.send(206, content_type, "");
+
+    char buf[256];
+    while(left>0){
+        int len=in.readBytes(buf, left<sizeof(buf) ? left : sizeof(buf));
+        if(len<=0) break;
+        httpd.sendContent(buf, len);
+        left-=len;
+    }
+}
+
+
+String LHWeb::parseTemplate(String html_file, LHConfig &data){
+    File f;
+    LHFlashFile flash;
+    Stream *in=openTemplate(html_file, f, flash);
+    if(!in){ 
         addLog("Error Template "+html_file+" does not exist", false);
         return ""; 
     }
     
-    File f = SPIFFS.open(html_file, "r");
-    while(c=f.read()){
-      if(c==255){ break; }   
-      //Serial.print(c);
-      //Serial.print(" ");
-      //Serial.print(state);
-      //Serial.print(" ");
-      if( state=='h' ){
-        if(c=='{'){
-          state='o';
-        }else{
-          out+=c;
-        }
-      }else if(state=='o'){
-        if(c=='{'){
-          state='s';
-          tag="";
-        }else{
-          out+="{";
-          out+=c;
-          state='h';
-        }
-      }else if(state=='s'){
-        if(c=='}'){
-          state='c';
-        }else if(c!=' '){
-          state='t';
-          tag+=c;
-        }
-      }else if(state=='t'){
-        if(c==' ' || c=='}'){
-          if(tag!=""){
-            if(data.exists(tag)){
-              out+=data.get(tag);
-            }
-            tag="";
-          }
-          if(c==' '){ state='s'; }
-          if(c=='}'){ state='c'; }
-        }else{
-          tag+=c;
-        }
-      }else if(state=='c'){
-        if(c!='}'){ out+=c; }
-        state='h';
-      }
-      //Serial.print(state);
-      //Serial.print(" ");
-      //Serial.println(tag);
-    }
+    StreamString out;
+    renderTemplate(in, NULL, data, out);
     f.close();
 
     data.clean();
@@ -687,10 +1799,31 @@ String LHWeb::parseTemplate(String html_file, LHConfig &data){
 
 
 String LHWeb::parseTemplateString(String tmpl_str, LHConfig &data){
-    String out="";
+    StreamString out;
+    renderTemplate(NULL, tmpl_str.c_str(), data, out);
+    return out;
+}
+
+
+// replaces the {{tags}} of a template read from in (or str if in is NULL)
+// with the values in data and writes the result to out. Tags that are
+// not in data are handed to the tags function if there is one.
+void LHWeb::renderTemplate(Stream *in, const char* str, LHConfig &data, Print &out, TTemplateFunction tags, TSectionFunction sections){
+    unsigned long start=micros();
+    renderStream(in, str, data, out, tags, sections);
+    profileRecord(profile_template, micros()-start);
+}
+
+
+// The body of a {{#name}}...{{/name}} section is read into RAM once
+// and rendered again for every row, so memory depends on the size of
+// the row markup, not on the number of rows. Sections of the same
+// name can not be nested.
+void LHWeb::renderStream(Stream *in, const char* str, LHConfig &data, Print &out, TTemplateFunction tags, TSectionFunction sections){
+    LHWriter tag_out(out);
     String tag;
-    char c;
-    int idx=0;
+    String section;
+    int c;
 
     // h - html
     // o - 1st open curly
@@ -699,25 +1832,22 @@ String LHWeb::parseTemplateString(String tmpl_str, LHConfig &data){
     // c - 1st closing curly
     char state='h';
     
-    while(c=tmpl_str[idx++]){
-      if(c==255 || c==0){ break; }   
-      //Serial.print(c);
-      //Serial.print(" ");
-      //Serial.print(state);
-      //Serial.print(" ");
+    while(true){
+      c = in ? in->read() : (uint8_t)*str++;
+      if(c<=0 || c==255){ break; }   
       if( state=='h' ){
         if(c=='{'){
           state='o';
         }else{
-          out+=c;
+          out.write(c);
         }
       }else if(state=='o'){
         if(c=='{'){
           state='s';
           tag="";
         }else{
-          out+="{";
-          out+=c;
+          out.write('{');
+          out.write(c);
           state='h';
         }
       }else if(state=='s'){
@@ -725,32 +1855,105 @@ String LHWeb::parseTemplateString(String tmpl_str, LHConfig &data){
           state='c';
         }else if(c!=' '){
           state='t';
-          tag+=c;
+          tag+=(char)c;
         }
       }else if(state=='t'){
         if(c==' ' || c=='}'){
-          if(tag!=""){
+          if(tag[0]=='#'){
+            section=tag.substring(1);
+          }else if(tag[0]=='/'){
+            // end of a section that was never opened
+          }else if(tag!=""){
             if(data.exists(tag)){
-              out+=data.get(tag);
+              out.print(data.get(tag));
+            }else if(tags){
+              tags(tag, tag_out);
             }
-            tag="";
           }
+          tag="";
           if(c==' '){ state='s'; }
           if(c=='}'){ state='c'; }
         }else{
-          tag+=c;
+          tag+=(char)c;
         }
       }else if(state=='c'){
-        if(c!='}'){ out+=c; }
+        if(c!='}'){ out.write(c); }
         state='h';
+        if(section!=""){
+          String end_tag="/"+section;
+          String body;
+          bool closed=false;
+          while(!closed){
+            c = in ? in->read() : (uint8_t)*str++;
+            if(c<=0 || c==255){ break; }
+            body+=(char)c;
+            // the end tag may have spaces around its name like any other tag
+            if(c!='}' || !body.endsWith("}}")) continue;
+            int open=body.lastIndexOf("{{");
+            if(open<0) continue;
+            String name=body.substring(open+2, body.length()-2);
+            name.trim();
+            if(name==end_tag){
+              body.remove(open);
+              closed=true;
+            }
+          }
+          if(closed){
+            for(int row=0; sections && sections(section, row); row++){
+              renderStream(NULL, body.c_str(), data, out, tags, sections);
+            }
+            section="";
+          }else{
+            // an unterminated section is rendered once like the rest of the page
+            renderStream(NULL, body.c_str(), data, out, tags, sections);
+            break;
+          }
+        }
       }
-      //Serial.print(state);
-      //Serial.print(" ");
-      //Serial.println(tag);
     }
+}
 
-    return out;
-  }
+
+// renders a template straight to the client, gzip compressed
+// if the client accepts it. Nothing is buffered beyond one chunk.
+void LHWeb::sendTemplate(String html_file, LHConfig &data, TTemplateFunction tags, TSectionFunction sections){
+    File f;
+    LHFlashFile flash;
+    Stream *in=openTemplate(html_file, f, flash);
+    if(!in){
+        addLog("Error Template "+html_file+" does not exist", false);
+        data.clean();
+        httpd.send(200, "text/html", "");
+        return;
+    }
+
+    char buf[CHUNK_BUFFER];
+    LHWriter writer(httpd, buf, sizeof(buf));
+    LHDeflate deflate(writer);
+    bool gzip=compress_pages && acceptsGzip() && deflate.begin();
+
+    httpd.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    httpd.sendHeader("Vary", "Accept-Encoding");
+    if(gzip) httpd.sendHeader("Content-Encoding", "gzip");
+    httpd.send(200, "text/html", "");
+
+    if(gzip){
+        renderTemplate(in, NULL, data, deflate, tags, sections);
+        deflate.finish();
+    }else{
+        renderTemplate(in, NULL, data, writer, tags, sections);
+    }
+    writer.flush();
+    httpd.sendContent("");
+
+    f.close();
+    data.clean();
+}
+
+
+void LHWeb::compressPages(bool compress){
+    compress_pages=compress;
+}
 
 
 
@@ -771,7 +1974,7 @@ void LHWeb::handleRoot(){
     data.add("flash_mem", sizing(fs_size())+"B" );
     data.add("board_id", String(boardID()) );
 
-    httpd.send(200, "text/html", parseTemplate("/index.tmpl", data) );
+    sendTemplate("/index.tmpl", data);
 }
 
 
@@ -784,10 +1987,10 @@ void LHWeb::handleWebConfig(){
         String pass=httpd.arg("wifi_pass");
         String host=httpd.arg("wifi_host");
         //Serial.println(ssid);
-        config.add("wifi_ssid", ssid);
-        config.add("wifi_pass", pass);
-        config.add("wifi_hostname", host);
-        config.save();
+        setConfig("wifi_ssid", ssid);
+        setConfig("wifi_pass", pass);
+        setConfig("wifi_hostname", host);
+        commitConfig();
         //config.dump();
         addLog("Config saved", false);
         banner="<div class=\"w3-container w3-section w3-green\"> \
@@ -802,26 +2005,36 @@ void LHWeb::handleWebConfig(){
     data.add("pass", Password() );
     data.add("host", Hostname() );
     data.add("banner", banner);
-    httpd.send(200, "text/html", parseTemplate("/webconfig.tmpl", data) );
+    sendTemplate("/webconfig.tmpl", data);
 
 }
 
 
 void LHWeb::handleLog(){
     addLog("Access /showlog",true);
-    String message = "";
-    for(int i=0; i<log.size(); i++){
-        if(debug) Serial.print("Log: ");
-        if(debug) Serial.print(i);
-        if(debug) Serial.print(" - ");
-        if(debug) Serial.println(log.get(i));
-        message += String("<tr><td>")+log.get(i)+"</td></tr>\n";
-    }
 
     LHConfig data("");
-    data.add("log", message);
-
-    httpd.send(200, "text/html", parseTemplate( "/log.tmpl", data) );
+    String entry;
+    sendTemplate("/log.tmpl", data, [&](const String& tag, LHWriter &out){
+        if(tag=="entry"){
+            out.printEscaped(entry);
+        }else if(tag=="log"){
+            // templates from before the sections
+            for(int i=0; i<log.size(); i++){
+                out.print("<tr><td>");
+                out.printEscaped(log.get(i));
+                out.print("</td></tr>\n");
+            }
+        }
+    }, [&](const String& section, int row){
+        if(section!="log" || row>=log.size()) return false;
+        entry=log.get(row);
+        if(debug) Serial.print("Log: ");
+        if(debug) Serial.print(row);
+        if(debug) Serial.print(" - ");
+        if(debug) Serial.println(entry);
+        return true;
+    });
 }
 
 
@@ -831,9 +2044,21 @@ void LHWeb::redirect(String uri){
 }
 
 
+void LHWeb::userConfigRow(LHWriter &out, int i, const char* key, const char* val){
+    out.print("<tr><td><input class=\"w3-input\" type=\"text\" name=\"key_");
+    out.print(i);
+    out.print("\" value=\"");
+    out.printEscaped(key);
+    out.print("\"></td><td><input class=\"w3-input\" type=\"text\" name=\"val_");
+    out.print(i);
+    out.print("\" value=\"");
+    out.printEscaped(val);
+    out.print("\"></td></tr>\n");
+}
+
+
 void LHWeb::handleUserConfig(){
     addLog( (String)"Access "+httpd.uri() , true);
-    String message = "";
     String banner="";
 
 
@@ -853,11 +2078,11 @@ void LHWeb::handleUserConfig(){
                 val.trim();
                 if(debug) Serial.println( key+"="+val );
                 if(key!=""){
-                    config.add(key, val);
+                    setConfig(key, val);
                 }          
             }
         }
-        config.save();
+        commitConfig();
 
         banner="<div class=\"w3-container w3-section w3-green\"> \
             <span onclick=\"this.parentElement.style.display='none'\" class=\"w3-closebtn\">x</span> \
@@ -868,34 +2093,51 @@ void LHWeb::handleUserConfig(){
     }
     
 
-    LHConfig::ConfigPair* c;
-    int i;
-    for(i=0; i<config.size(); i++){
-        c=config.get(i);
-        if(c->key=="wifi_ssid" || c->key=="wifi_pass" || c->key=="wifi_hostname" ){
-                continue;
-        }
-        message += "<tr>";
-        message += (String)"<td><input class=\"w3-input\" type=\"text\" name=\"key_"+String(i)+"\" value=\""+c->key+"\"></td>";
-        message += (String)"<td><input class=\"w3-input\" type=\"text\" name=\"val_"+String(i)+"\" value=\""+c->val+"\"></td>";
-        message += "<tr>\n";
-    }
-    for(int j=0; j<2; j++,i++){
-        message += "<tr>";
-        message += (String)"<td><input class=\"w3-input\" type=\"text\" name=\"key_"+String(i)+"\" value=\"\"></td>";
-        message += (String)"<td><input class=\"w3-input\" type=\"text\" name=\"val_"+String(i)+"\" value=\"\"></td>";
-        message += "<tr>\n";
-    }
-
     LHConfig data("");
     data.add("banner", banner);
-    data.add("userconfig", message);
-    httpd.send(200, "text/html", parseTemplate( "/userconfig.tmpl", data) );
+    // config entry of the current row, the two after the last one are
+    // empty rows for new entries
+    int index=-1;
+    sendTemplate("/userconfig.tmpl", data, [&](const String& tag, LHWriter &out){
+        bool empty=index>=config.size();
+        if(tag=="index"){
+            out.print(index);
+        }else if(tag=="key" && !empty){
+            out.printEscaped(config.get(index)->key);
+        }else if(tag=="val" && !empty){
+            out.printEscaped(config.get(index)->val);
+        }else if(tag=="userconfig"){
+            // templates from before the sections
+            int i;
+            for(i=0; i<config.size(); i++){
+                LHConfig::ConfigPair* c=config.get(i);
+                if(c->key=="wifi_ssid" || c->key=="wifi_pass" || c->key=="wifi_hostname") continue;
+                userConfigRow(out, i, c->key.c_str(), c->val.c_str());
+            }
+            for(int j=0; j<2; j++,i++){
+                userConfigRow(out, i, "", "");
+            }
+        }
+    }, [&](const String& section, int row){
+        if(section!="userconfig") return false;
+        index++;
+        while(index<config.size()){
+            LHConfig::ConfigPair* c=config.get(index);
+            if(c->key!="wifi_ssid" && c->key!="wifi_pass" && c->key!="wifi_hostname") break;
+            index++;
+        }
+        return index<config.size()+2;
+    });
 }
 
 
 void LHWeb::handleReset(){
     addLog( (String)"Access "+httpd.uri() , true);
+    // changes still waiting for CONFIG_QUIET would be lost
+    if(!commitConfig()){
+        httpd.send ( 500, "text/plain", "ERROR config not saved\n" );
+        return;
+    }
     httpd.send ( 200, "text/plain", "Resetting\n" );
     delay(200);
     system_restart();
@@ -923,8 +2165,14 @@ String LHWeb::string2hex(String in){
 
 
 
+// uploads go to a temporary file in page aligned blocks and replace
+// the target only when they are complete and the optional CRC matches
 void LHWeb::fileUpload(){
-    int bytes_written;
+    // the rest of a request over the limit is read and thrown away
+    // and a verdict only holds for the request it was made for
+    if(httpd.upload().status == UPLOAD_FILE_START && !admitRequest(RATE_UPLOAD)) upload_limited=httpd.requests;
+    if(upload_limited==httpd.requests) return;
+    if(httpd.uri() == "/deploy") return deployUpload();
     if(httpd.uri() != "/upload") return;
     HTTPUpload& upload = httpd.upload();
     if(upload.status == UPLOAD_FILE_START){
@@ -933,38 +2181,364 @@ void LHWeb::fileUpload(){
         if(!filename.startsWith("/")) filename = "/"+filename;
         if(debug) Serial.print("handleFileUpload Name: "); 
         if(debug) Serial.println(filename);
-        fsUploadFile = SPIFFS.open(filename, "w");
-        filename = String();
         uploadError="";
+        upload_start=millis();
+        if(!upload_file.open(filename)){
+            uploadError="Error opening file";
+        }
     } else if(upload.status == UPLOAD_FILE_WRITE){
         if(debug) Serial.print("handleFileUpload Data: ");
-        if(debug) Serial.print(upload.currentSize);
-        if(fsUploadFile){
-            bytes_written = fsUploadFile.write(upload.buf, upload.currentSize);
-            if(debug) Serial.print("   Bytes written: ");
-            if(debug) Serial.println(bytes_written);
-        }else{
+        if(debug) Serial.println(upload.currentSize);
+        if(!upload_file.write(upload.buf, upload.currentSize)){
             if(debug) Serial.println("Nothing written");
             uploadError="Error writing file";
         }
     } else if(upload.status == UPLOAD_FILE_END){
-        if(fsUploadFile){
-            fsUploadFile.close();
-        }else{
-            if(debug) Serial.println("File Error");
-            addLog("Upload error");
+        if(!upload_file.close()){
+            uploadError="Error writing file";
+        }
+        String expected=httpd.header("X-Upload-CRC32");
+        if(uploadError=="" && expected.length()>0 && strtoul(expected.c_str(), NULL, 16)!=upload_file.crc){
+            uploadError="CRC mismatch";
+        }
+        if(uploadError=="" && !upload_file.commit()){
+            uploadError="Error renaming file";
         }
         if(debug) Serial.print("handleFileUpload Size: "); 
         if(debug) Serial.println(upload.totalSize);
-        addLog("Upload complete "+upload.filename+" "+String(upload.totalSize) , true);
+
+        if(uploadError==""){
+            indexAsset(upload_file.path, upload_file.size, upload_file.crc);
+            unsigned long ms=millis()-upload_start;
+            metrics.uploads++;
+            metrics.upload_bytes+=upload_file.size;
+            metrics.upload_rate= ms>0 ? (unsigned long long)upload_file.size*1000/ms : upload_file.size;
+            addLog("Upload complete "+upload.filename+" "+String(upload.totalSize)+" "+String(metrics.upload_rate)+"B/s" , true);
+        }else{
+            upload_file.abort();
+            metrics.upload_failures++;
+            addLog("Upload error "+upload.filename+" "+uploadError);
+        }
+    } else if(upload.status == UPLOAD_FILE_ABORTED){
+        upload_file.abort();
+        metrics.upload_failures++;
+        uploadError="Upload aborted";
+        addLog("Upload aborted "+upload.filename);
     }
 }
 
 void LHWeb::onUpload(){
-    httpd.sendHeader("Connection", "close");
+    if(upload_limited==httpd.requests) return sendTooManyRequests();
+    httpd.sendHeader("Access-Control-Allow-Origin", "*");
+
+    httpd.send(uploadError=="" ? 200 : 500, "text/plain", uploadError);     
+}
+
+
+// /deploy takes a tar archive as multipart upload and unpacks it while it
+// arrives. Every file is staged like a single upload, the whole set is
+// renamed into place only after the archive was read without errors.
+// The replaced files are kept until every rename worked, if one fails
+// the renamed ones are put back so the node keeps the old set.
+void LHWeb::deployUpload(){
+    HTTPUpload& upload = httpd.upload();
+    if(upload.status == UPLOAD_FILE_START){
+        addLog("Deploy "+upload.filename, true);
+        deployReset();
+        deploy_error="";
+        upload_start=millis();
+        deploy_header=(uint8_t*)malloc(TAR_BLOCK);
+        if(!deploy_header) deploy_error="Out of memory";
+    } else if(upload.status == UPLOAD_FILE_WRITE){
+        if(deploy_error=="") deployData(upload.buf, upload.currentSize);
+    } else if(upload.status == UPLOAD_FILE_END){
+        if(deploy_error=="" && (deploy_left>0 || deploy_header_len>0)){
+            deploy_error="Archive truncated";
+        }
+        if(deploy_error==""){
+            // swap in the new set, the old files stay aside until the end
+            int committed=0;
+            for(; committed<deploy_files.size(); committed++){
+                DeployEntry *entry=deploy_files.get(committed);
+                StagedFile staged;
+                staged.path=entry->path;
+                staged.tmp_path=StagedFile::tmpPath(entry->path);
+                if(!staged.commit(true)){
+                    deploy_error="Error renaming "+entry->path;
+                    break;
+                }
+                entry->replaced=staged.replaced;
+            }
+            if(deploy_error==""){
+                // the index only learns about the new set once all of it is there
+                for(int i=0; i<deploy_files.size(); i++){
+                    DeployEntry *entry=deploy_files.get(i);
+                    if(entry->replaced) SPIFFS.remove(StagedFile::oldPath(entry->path));
+                    indexAsset(entry->path, entry->size, entry->crc);
+                    metrics.upload_bytes+=entry->size;
+                }
+                metrics.uploads++;
+                addLog("Deploy complete "+String(deploy_files.size())+" files "+String(upload.totalSize)+" "+String(millis()-upload_start)+"ms", true);
+            }else{
+                // back to the old set, newest first
+                for(int i=committed-1; i>=0; i--){
+                    DeployEntry *entry=deploy_files.get(i);
+                    SPIFFS.remove(entry->path);
+                    if(entry->replaced && !SPIFFS.rename(StagedFile::oldPath(entry->path), entry->path)){
+                        addLog("Deploy error restoring "+entry->path);
+                    }
+                }
+                deployAbort();
+            }
+        }else{
+            deployAbort();
+        }
+        deployReset();
+    } else if(upload.status == UPLOAD_FILE_ABORTED){
+        deploy_error="Upload aborted";
+        deployAbort();
+        deployReset();
+    }
+}
+
+
+void LHWeb::onDeploy(){
+    if(upload_limited==httpd.requests) return sendTooManyRequests();
     httpd.sendHeader("Access-Control-Allow-Origin", "*");
 
-    httpd.send(200, "text/plain", uploadError);     
+    httpd.send(deploy_error=="" ? 200 : 500, "text/plain", deploy_error);     
+}
+
+
+// consumes a piece of the tar stream: 512 byte headers, file data
+// padded to full blocks, two empty blocks at the end
+void LHWeb::deployData(const uint8_t* data, size_t n){
+    while(n>0 && deploy_error==""){
+        size_t part;
+        if(deploy_skip>0){
+            part= deploy_skip<n ? deploy_skip : n;
+            deploy_skip-=part;
+        }else if(deploy_left>0){
+            part= deploy_left<n ? deploy_left : n;
+            if(!deploy_file.write(data, part)) deploy_error="Error writing "+deploy_file.path;
+            deploy_left-=part;
+            if(deploy_left==0) deployFileDone();
+        }else if(deploy_done){
+            return;
+        }else{
+            part=TAR_BLOCK-deploy_header_len;
+            if(part>n) part=n;
+            memcpy(deploy_header+deploy_header_len, data, part);
+            deploy_header_len+=part;
+            if(deploy_header_len==TAR_BLOCK){
+                deploy_header_len=0;
+                deployHeader();
+            }
+        }
+        data+=part;
+        n-=part;
+    }
+}
+
+
+static size_t tarOctal(const uint8_t* field, uint8_t len){
+    size_t value=0;
+    uint8_t i=0;
+    while(i<len && field[i]==' ') i++;
+    for(; i<len && field[i]>='0' && field[i]<='7'; i++){
+        value=value*8+field[i]-'0';
+    }
+    return value;
+}
+
+
+void LHWeb::deployHeader(){
+    const uint8_t *h=deploy_header;
+    if(h[0]==0x1f && h[1]==0x8b){
+        deploy_error="Compressed archives are not supported";
+        return;
+    }
+
+    // an empty block ends the archive
+    unsigned long sum=0;
+    for(uint16_t i=0; i<TAR_BLOCK; i++){
+        sum+= (i>=148 && i<156) ? ' ' : h[i];
+    }
+    if(sum==8*' '){
+        deploy_done=true;
+        return;
+    }
+    if(sum!=tarOctal(h+148, 8)){
+        deploy_error="Archive checksum error";
+        return;
+    }
+
+    size_t size=tarOctal(h+124, 12);
+    size_t padding=(TAR_BLOCK-size%TAR_BLOCK)%TAR_BLOCK;
+    char type=h[156];
+    if(type!='0' && type!=0){
+        // directories, links and extended headers
+        deploy_skip=size+padding;
+        return;
+    }
+
+    // ustar splits long names into prefix and name
+    String path="";
+    if(memcmp(h+257, "ustar", 5)==0 && h[345]){
+        path.concat((const char*)h+345, strnlen((const char*)h+345, 155));
+        path+="/";
+    }
+    path.concat((const char*)h, strnlen((const char*)h, 100));
+    while(path.startsWith("./") || path.startsWith("/")) path=path.substring(1);
+    path="/"+path;
+    if(path.length()>31){
+        deploy_error="File name too long "+path;
+        return;
+    }
+    // both would be staged under the same temporary name
+    for(int i=0; i<deploy_files.size(); i++){
+        if(deploy_files.get(i)->path==path){
+            deploy_error="Duplicate entry "+path;
+            return;
+        }
+    }
+
+    if(!deploy_file.open(path)){
+        deploy_error="Error opening "+path;
+        return;
+    }
+    deploy_left=size;
+    deploy_padding=padding;
+    if(size==0) deployFileDone();
+}
+
+
+void LHWeb::deployFileDone(){
+    if(!deploy_file.close()){
+        deploy_error="Error writing "+deploy_file.path;
+        return;
+    }
+    DeployEntry *entry=new DeployEntry();
+    entry->path=deploy_file.path;
+    entry->size=deploy_file.size;
+    entry->crc=deploy_file.crc;
+    entry->replaced=false;
+    deploy_files.add(entry);
+    deploy_skip=deploy_padding;
+}
+
+
+// removes all staged files of a failed deploy
+void LHWeb::deployAbort(){
+    deploy_file.abort();
+    for(int i=0; i<deploy_files.size(); i++){
+        SPIFFS.remove(StagedFile::tmpPath(deploy_files.get(i)->path));
+    }
+    metrics.upload_failures++;
+    addLog("Deploy error "+deploy_error);
+}
+
+
+void LHWeb::deployReset(){
+    while(deploy_files.size()>0){
+        delete deploy_files.pop();
+    }
+    free(deploy_header);
+    deploy_header=NULL;
+    deploy_header_len=0;
+    deploy_left=0;
+    deploy_skip=0;
+    deploy_padding=0;
+    deploy_done=false;
+}
+
+
+// the temporary name only depends on the target, so a
+// left over from an interrupted upload gets reused
+String LHWeb::StagedFile::tmpPath(const String& target){
+    char tmp[16];
+    sprintf(tmp, "/.up%08x", pathHash(target));
+    return tmp;
+}
+
+String LHWeb::StagedFile::oldPath(const String& target){
+    char old[16];
+    sprintf(old, "/.upo%08x", pathHash(target));
+    return old;
+}
+
+bool LHWeb::StagedFile::open(const String& target){
+    // an earlier upload that never saw its end
+    if(buf) abort();
+    path=target;
+    tmp_path=tmpPath(target);
+    len=0;
+    size=0;
+    crc=0;
+    error=false;
+    buf=(uint8_t*)malloc(UPLOAD_BUFFER);
+    file=SPIFFS.open(tmp_path, "w");
+    if(!buf || !file){
+        abort();
+        return false;
+    }
+    return true;
+}
+
+bool LHWeb::StagedFile::write(const uint8_t* data, size_t n){
+    if(!buf) return false;
+    crc=LHDeflate::crc32(crc, data, n);
+    size+=n;
+    while(n>0){
+        size_t part=UPLOAD_BUFFER-len;
+        if(part>n) part=n;
+        memcpy(buf+len, data, part);
+        len+=part;
+        data+=part;
+        n-=part;
+        if(len==UPLOAD_BUFFER && !flush()) return false;
+    }
+    return !error;
+}
+
+bool LHWeb::StagedFile::flush(){
+    if(len>0 && file.write(buf, len)!=len) error=true;
+    len=0;
+    return !error;
+}
+
+// writes what is left, the file keeps its temporary name
+bool LHWeb::StagedFile::close(){
+    if(!buf) return false;
+    flush();
+    file.close();
+    free(buf);
+    buf=NULL;
+    return !error;
+}
+
+// the old file is renamed aside first and only removed once the new
+// one is in place, a failed rename puts it back
+bool LHWeb::StagedFile::commit(bool keep_old){
+    String old_path=oldPath(path);
+    replaced=SPIFFS.exists(path);
+    if(replaced){
+        SPIFFS.remove(old_path);
+        if(!SPIFFS.rename(path, old_path)) return false;
+    }
+    if(!SPIFFS.rename(tmp_path, path)){
+        if(replaced) SPIFFS.rename(old_path, path);
+        return false;
+    }
+    if(replaced && !keep_old) SPIFFS.remove(old_path);
+    return true;
+}
+
+void LHWeb::StagedFile::abort(){
+    if(file) file.close();
+    free(buf);
+    buf=NULL;
+    if(tmp_path.length()>0) SPIFFS.remove(tmp_path);
 }
 
 
@@ -993,20 +2567,193 @@ void LHWeb::dumpFile(String file_name){
 
 String LHWeb::getContentType(String filename){
     if(httpd.hasArg("download")) return "application/octet-stream";
-    else if(filename.endsWith(".htm")) return "text/html";
-    else if(filename.endsWith(".html")) return "text/html";
-    else if(filename.endsWith(".css")) return "text/css";
-    else if(filename.endsWith(".js")) return "application/javascript";
-    else if(filename.endsWith(".png")) return "image/png";
-    else if(filename.endsWith(".gif")) return "image/gif";
-    else if(filename.endsWith(".jpg")) return "image/jpeg";
-    else if(filename.endsWith(".ico")) return "image/x-icon";
-    else if(filename.endsWith(".svg")) return "image/svg+xml";
-    else if(filename.endsWith(".xml")) return "text/xml";
-    else if(filename.endsWith(".pdf")) return "application/x-pdf";
-    else if(filename.endsWith(".zip")) return "application/x-zip";
-    else if(filename.endsWith(".gz")) return "application/x-gzip";
-    return "text/plain";
+    return mime_types[mimeType(filename)];
+}
+
+uint8_t LHWeb::mimeType(const String& filename){
+    for(uint8_t i=1; i<MIME_COUNT; i++){
+        if(filename.endsWith(mime_extensions[i])) return i;
+    }
+    return 0;
+}
+
+
+// FNV-1a, 0 is reserved for empty index slots
+uint32_t LHWeb::pathHash(const String& path){
+    uint32_t hash=2166136261UL;
+    for(unsigned int i=0; i<path.length(); i++){
+        hash^=(uint8_t)path[i];
+        hash*=16777619UL;
+    }
+    return hash ? hash : 1;
+}
+
+
+uint32_t LHWeb::crc32(uint32_t crc, const uint8_t* buf, size_t len){
+    return LHDeflate::crc32(crc, buf, len);
+}
+
+
+void LHWeb::setCacheMaxAge(const char* extension, unsigned long seconds){
+    for(uint8_t i=0; i<MIME_COUNT; i++){
+        if(strcmp(mime_extensions[i], extension)==0) cache_max_age[i]=seconds;
+    }
+}
+
+String LHWeb::cacheControl(uint8_t mime){
+    if(cache_max_age[mime]==0) return "no-cache";
+    return (String)"max-age="+cache_max_age[mime];
+}
+
+
+bool LHWeb::acceptsGzip(){
+    return httpd.header("Accept-Encoding").indexOf("gzip")>=0;
+}
+
+
+void LHWeb::checkFiles(){
+    indexAssets();
+}
+
+
+void LHWeb::indexAssets(){
+    memset(assets, 0, sizeof(assets));
+    asset_count=0;
+    Dir dir = SPIFFS.openDir("/");
+    while(dir.next()){
+        // left over of an interrupted upload
+        if(dir.fileName().startsWith("/.up")) continue;
+        indexAsset(dir.fileName());
+        yield();
+    }
+    if(debug) Serial.println((String)"Indexed "+asset_count+" files");
+}
+
+
+// reads the file once to get its CRC
+LHWeb::Asset* LHWeb::indexAsset(const String& path){
+    File file = SPIFFS.open(path, "r");
+    if(!file) return NULL;
+    uint8_t buf[128];
+    uint32_t crc=0;
+    size_t len;
+    while( (len=file.read(buf, sizeof(buf)))>0 ){
+        crc=crc32(crc, buf, len);
+        // big files take long enough to trip the watchdog
+        yield();
+    }
+    size_t size=file.size();
+    file.close();
+    return indexAsset(path, size, crc);
+}
+
+
+// open addressing with linear probing
+LHWeb::Asset* LHWeb::indexAsset(const String& path, uint32_t size, uint32_t crc){
+    // let the plain file know about its compressed sibling and vice versa
+    uint8_t flags=0;
+    if(path.endsWith(".gz")){
+        Asset *plain=findAsset(path.substring(0, path.length()-3));
+        if(plain) plain->flags|=ASSET_GZIP;
+    }else if(findAsset(path+".gz")){
+        flags|=ASSET_GZIP;
+    }
+
+    uint32_t hash=pathHash(path);
+    uint8_t slot=hash & (MAX_ASSETS-1);
+    for(uint8_t n=0; n<MAX_ASSETS; n++){
+        Asset &asset=assets[slot];
+        if(asset.path_hash==0 || asset.path_hash==hash){
+            if(asset.path_hash==0) asset_count++;
+            asset.path_hash=hash;
+            asset.size=size;
+            asset.crc=crc;
+            asset.mime=mimeType(path);
+            asset.flags=flags;
+            return &asset;
+        }
+        slot=(slot+1) & (MAX_ASSETS-1);
+    }
+    addLog("Error asset index full", false);
+    return NULL;
+}
+
+
+LHWeb::Asset* LHWeb::findAsset(const String& path){
+    uint32_t hash=pathHash(path);
+    uint8_t slot=hash & (MAX_ASSETS-1);
+    for(uint8_t n=0; n<MAX_ASSETS; n++){
+        Asset &asset=assets[slot];
+        if(asset.path_hash==0) return NULL;
+        if(asset.path_hash==hash) return &asset;
+        slot=(slot+1) & (MAX_ASSETS-1);
+    }
+    return NULL;
+}
+
+
+const LHWeb::Asset* LHWeb::findBundled(const String& path){
+    // a file in SPIFFS replaces the bundled copy together with its .gz variant
+    String plain=path.endsWith(".gz") ? path.substring(0, path.length()-3) : path;
+    if(findAsset(plain) || findAsset(plain+".gz")) return NULL;
+
+    uint32_t hash=pathHash(path);
+    for(uint8_t i=0; i<BUNDLE_COUNT; i++){
+        if(bundle_assets[i].path_hash==hash) return &bundle_assets[i];
+    }
+    return NULL;
+}
+
+
+const LHWeb::Asset* LHWeb::lookupAsset(const String& path){
+    Asset *asset=findAsset(path);
+    if(asset) return asset;
+    return findBundled(path);
+}
+
+
+LHFlashFile LHWeb::openBundled(const Asset *asset){
+    uint8_t i=asset-bundle_assets;
+    return LHFlashFile(bundle_data[i], bundle_assets[i].size, bundle_paths[i]);
+}
+
+
+Stream* LHWeb::openTemplate(const String& path, File &file, LHFlashFile &flash){
+    if(findAsset(path)){
+        file=SPIFFS.open(path, "r");
+        if(file) return &file;
+    }
+    const Asset *bundled=findBundled(path);
+    if(!bundled) return NULL;
+    flash=openBundled(bundled);
+    return &flash;
+}
+
+
+void LHWeb::unindexAsset(const String& path){
+    Asset *asset=findAsset(path);
+    if(!asset) return;
+    if(path.endsWith(".gz")){
+        Asset *plain=findAsset(path.substring(0, path.length()-3));
+        if(plain) plain->flags&=~ASSET_GZIP;
+    }
+
+    // shift the following entries back so no probe chain gets broken
+    uint8_t hole=asset-assets;
+    uint8_t slot=hole;
+    asset->path_hash=0;
+    asset_count--;
+    while(true){
+        slot=(slot+1) & (MAX_ASSETS-1);
+        if(assets[slot].path_hash==0) return;
+        uint8_t home=assets[slot].path_hash & (MAX_ASSETS-1);
+        // move the entry if its home is not between the hole and its slot
+        if( ((slot-home) & (MAX_ASSETS-1)) >= ((slot-hole) & (MAX_ASSETS-1)) ){
+            assets[hole]=assets[slot];
+            assets[slot].path_hash=0;
+            hole=slot;
+        }
+    }
 }
 
 void LHWeb::handleBrowse(){
@@ -1019,40 +2766,42 @@ void LHWeb::handleBrowse(){
     
     if( !httpd.hasArg("cmd") ){
         addLog("Access /browse",true);
-        String message = "";
+        LHConfig data("");
         Dir dir = SPIFFS.openDir("/");
-  
-        String html_string;
-        String plain_string;
-        char c;
-        char buf[10];
-        while(dir.next()){
-            File entry = dir.openFile("r");
-            bool isDir = false;
-            plain_string=entry.name();
-            message += "<tr>";
-            message += String("<td><a href=\"")+entry.name()+"\">"+entry.name()+"</a></td>";
-            message += String("<td>")+sizing(entry.size())+"B</td>";
-            html_string="";
-            for(int i=0; i<plain_string.length(); i++){
-                c=plain_string[i];
-                if( c>='0' && c<='9' || c>='A' && c<='Z' || c>='a' && c<='z'){
-                    html_string+=c;
-                }else{
-                    sprintf(buf, "%02X", c);
-                    html_string+="%";
-                    html_string+=buf;
+        String name;
+        size_t size=0;
+        sendTemplate("/browse.tmpl", data, [&](const String& tag, LHWriter &out){
+            if(tag=="name"){
+                out.printEscaped(name);
+            }else if(tag=="name_url"){
+                out.printUrlEncoded(name);
+            }else if(tag=="size"){
+                out.printSize(size);
+            }else if(tag=="file_list"){
+                // templates from before the sections
+                Dir all = SPIFFS.openDir("/");
+                while(all.next()){
+                    File entry = all.openFile("r");
+                    out.print("<tr><td><a href=\"");
+                    out.printEscaped(entry.name());
+                    out.print("\">");
+                    out.printEscaped(entry.name());
+                    out.print("</a></td><td>");
+                    out.printSize(entry.size());
+                    out.print("B</td><td><a href=\"/browse?cmd=del&amp;file=");
+                    out.printUrlEncoded(entry.name());
+                    out.print("\">X</a></td></tr>\n");
+                    entry.close();
                 }
             }
-            message += String("<td><a href=\"/browse?cmd=del&file=")+html_string+"\">X</a></td>";
-            message += "</tr>\n";
-            //addLog(String("  ")+entry.name() );
+        }, [&](const String& section, int row){
+            if(section!="files" || !dir.next()) return false;
+            File entry = dir.openFile("r");
+            name=entry.name();
+            size=entry.size();
             entry.close();
-        }
-        LHConfig data("");
-        data.add("file_list", message);
-  
-        httpd.send(200, "text/html", parseTemplate( "/browse.tmpl", data) );
+            return true;
+        });
     }else if(httpd.arg("cmd")=="del"){        
         String file_name = httpd.arg("file");
         addLog("Delete "+file_name, true);
@@ -1062,6 +2811,7 @@ void LHWeb::handleBrowse(){
         }else{
             int ret=SPIFFS.remove(file_name);
             if(debug) Serial.println("File rmoved: "+String(ret));
+            unindexAsset(file_name);
             redirect("/browse");
         }
     }else if(httpd.arg("cmd")=="show"){
@@ -1072,18 +2822,55 @@ void LHWeb::handleBrowse(){
 
 
 
+// one line per file: <path> <size> <crc32>, "bundle" after the files
+// served from the firmware. Size and CRC come from the asset index and
+// the bundle, no file gets read
+void LHWeb::handleManifest(){
+    char buf[CHUNK_BUFFER];
+    LHWriter writer(httpd, buf, sizeof(buf));
+    char line[64];
+
+    httpd.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    httpd.sendHeader("Cache-Control", "no-cache");
+    httpd.send(200, "text/plain", "");
+
+    Dir dir = SPIFFS.openDir("/");
+    while(dir.next()){
+        String name=dir.fileName();
+        Asset *asset=findAsset(name);
+        if(!asset) continue;
+        writer.print(name);
+        sprintf(line, " %u %08x\n", asset->size, asset->crc);
+        writer.print(line);
+    }
+    // bundled files SPIFFS does not replace, marked because uploading
+    // one of a file and its .gz variant hides the bundled other one
+    for(uint8_t i=0; i<BUNDLE_COUNT; i++){
+        if(findBundled(bundle_paths[i])!=&bundle_assets[i]) continue;
+        writer.print(bundle_paths[i]);
+        sprintf(line, " %u %08x bundle\n", bundle_assets[i].size, bundle_assets[i].crc);
+        writer.print(line);
+    }
+    writer.flush();
+    httpd.sendContent("");
+}
+
+
 void LHWeb::handleFormat(){
     SPIFFS.format();
+    indexAssets();
     return httpd.send(404, "text/plain", "File System has been formated");
 }
 
 
 void LHWeb::resetConfigToDefaults(){
     SPIFFS.remove("lhweb.conf");
+    SPIFFS.remove(CONFIG_JOURNAL);
+    while(config_pending.size()>0) config_pending.pop();
     if(debug) dumpFileList();
     config.add("wifi_pass", "");
     config.add("wifi_ssid", "");
-    if(debug) Serial.println(config.save());
+    if(debug) Serial.println(saveConfig());
     if(debug) config.dump();
     if(debug) dumpFileList();
 }
@@ -1127,11 +2914,260 @@ String LHWeb::sizing(size_t value){
 
 
 void LHWeb::sendStatus(const char* channel, const char* state){
-    broadcast((String)"state "+channel+" "+state);
+    String msg=(String)"state "+channel+" "+state;
+    broadcast(msg);
+    websocket.broadcast(NULL, msg);
+    announceState(channel, state);
 }
 
+
+// remembers the state, handleAnnounce() sends it with the other
+// changes of the next ANNOUNCE_COALESCE ms in one datagram
+void LHWeb::announceState(const char* channel, const char* state){
+    if((uint32_t)announce_group==0) return;
+    ChannelState *entry=NULL;
+    for(uint8_t i=0; i<announce_count; i++){
+        if(announce_states[i].channel==channel){
+            entry=&announce_states[i];
+            break;
+        }
+    }
+    if(entry==NULL){
+        if(announce_count<ANNOUNCE_CHANNELS){
+            entry=&announce_states[announce_count++];
+        }else{
+            // table full, the least recently changed channel that is already
+            // out makes room. Only when every one still waits they go out now.
+            unsigned long now=millis();
+            for(uint8_t i=0; i<ANNOUNCE_CHANNELS; i++){
+                ChannelState &candidate=announce_states[i];
+                if(candidate.dirty) continue;
+                if(entry==NULL || now-candidate.changed > now-entry->changed) entry=&candidate;
+            }
+            if(entry==NULL){
+                sendAnnouncement(false);
+                entry=&announce_states[0];
+                for(uint8_t i=1; i<ANNOUNCE_CHANNELS; i++){
+                    if(now-announce_states[i].changed > now-entry->changed) entry=&announce_states[i];
+                }
+            }
+        }
+        entry->channel=channel;
+    }
+    entry->state=state;
+    entry->dirty=true;
+    entry->changed=millis();
+    if(announce_changed==0) announce_changed=millis() | 1;
+}
+
+
+void LHWeb::handleAnnounce(){
+    if((uint32_t)announce_group==0 || WiFi.status()!=WL_CONNECTED) return;
+    unsigned long now=millis();
+    if(now-announce_heartbeat>=announce_interval){
+        sendAnnouncement(true);
+    }else if(announce_changed && now-announce_changed>=ANNOUNCE_COALESCE){
+        sendAnnouncement(false);
+    }
+}
+
+
+// "lhweb <id> <seq> state" or "lhweb <id> <seq> heartbeat <uptime s> <rssi> <free heap>"
+// followed by a "<channel> <state>" line for every changed channel, a
+// heartbeat lists all of them. Receivers see lost datagrams as gaps in seq.
+void LHWeb::sendAnnouncement(bool heartbeat){
+    if(!announce_udp.beginPacketMulticast(announce_group, announce_port, WiFi.localIP())) return;
+    announce_seq++;
+    announce_udp.print("lhweb ");
+    announce_udp.print(short_mac);
+    announce_udp.print(' ');
+    announce_udp.print(announce_seq);
+    if(heartbeat){
+        announce_udp.print(" heartbeat ");
+        announce_udp.print(millis()/1000);
+        announce_udp.print(' ');
+        announce_udp.print(WiFi.RSSI());
+        announce_udp.print(' ');
+        announce_udp.print(ESP.getFreeHeap());
+    }else{
+        announce_udp.print(" state");
+    }
+    announce_udp.print('\n');
+    for(uint8_t i=0; i<announce_count; i++){
+        ChannelState &entry=announce_states[i];
+        if(!heartbeat && !entry.dirty) continue;
+        announce_udp.print(entry.channel);
+        announce_udp.print(' ');
+        announce_udp.print(entry.state);
+        announce_udp.print('\n');
+        entry.dirty=false;
+    }
+    announce_udp.endPacket();
+    metrics.announcements++;
+    announce_changed=0;
+    if(heartbeat) announce_heartbeat=millis();
+}
+
+bool LHWeb::saveConfig(){
+    unsigned long start=micros();
+    bool ret=config.save();
+    // the snapshot has everything, the journal would only replay older values
+    if(ret){
+        SPIFFS.remove(CONFIG_JOURNAL);
+        while(config_pending.size()>0) config_pending.pop();
+    }
+    profileRecord(profile_config, micros()-start);
+    return ret;
+}
+
+// A journal entry is 0xC5, the key length, the value length (2 bytes),
+// key, value and the CRC32 of all that. Numbers are lsb first.
+#define JOURNAL_MAGIC 0xC5
+
+void LHWeb::setConfig(const String& key, const String& val){
+    config.add(key, val);
+    config_changed=millis();
+    for(int i=0; i<config_pending.size(); i++){
+        if(config_pending.get(i)==key) return;
+    }
+    config_pending.add(key);
+}
+
+
+bool LHWeb::commitConfig(){
+    if(config_pending.size()==0 && !config_snapshot) return true;
+    unsigned long start=micros();
+    bool ok=true;
+
+    if(!config_snapshot){
+        File journal=SPIFFS.open(CONFIG_JOURNAL, "a");
+        ok=journal;
+        for(int i=0; ok && i<config_pending.size(); i++){
+            String key=config_pending.get(i);
+            String val=config.get(key);
+            if(key.length()>255 || val.length()>0xFFFF){
+                // does not fit into an entry
+                config_snapshot=true;
+                break;
+            }
+            uint8_t header[4]={ JOURNAL_MAGIC, (uint8_t)key.length(), (uint8_t)(val.length() & 0xFF), (uint8_t)(val.length()>>8) };
+            uint32_t crc=crc32(0, header, sizeof(header));
+            crc=crc32(crc, (const uint8_t*)key.c_str(), key.length());
+            crc=crc32(crc, (const uint8_t*)val.c_str(), val.length());
+            uint8_t trailer[4];
+            for(uint8_t b=0; b<4; b++) trailer[b]=(crc>>(8*b)) & 0xFF;
+            ok= journal.write(header, sizeof(header))==sizeof(header)
+                && journal.write((const uint8_t*)key.c_str(), key.length())==key.length()
+                && journal.write((const uint8_t*)val.c_str(), val.length())==val.length()
+                && journal.write(trailer, sizeof(trailer))==sizeof(trailer);
+        }
+        if(journal){
+            if(journal.size()>=JOURNAL_MAX) config_snapshot=true;
+            journal.close();
+        }
+        // a journal that can not be written is replaced by a snapshot
+        if(!ok) config_snapshot=true;
+    }
+
+    if(config_snapshot){
+        // saveConfig() drops the journal once the snapshot is written
+        ok=saveConfig();
+        if(ok){
+            config_snapshot=false;
+            metrics.config_snapshots++;
+        }
+    }
+
+    if(ok){
+        while(config_pending.size()>0) config_pending.pop();
+        metrics.config_commits++;
+    }else{
+        addLog("Error config not saved", false);
+    }
+    profileRecord(profile_journal, micros()-start);
+    return ok;
+}
+
+
+// commits the pending changes once they stopped coming in
+void LHWeb::handleConfig(){
+    if(config_pending.size()>0 && millis()-config_changed>=CONFIG_QUIET){
+        commitConfig();
+    }
+}
+
+
+// applies the journal to the config read from lhweb.conf, up to the
+// first entry that is incomplete or fails its CRC
+void LHWeb::replayJournal(){
+    File journal=SPIFFS.open(CONFIG_JOURNAL, "r");
+    if(!journal) return;
+
+    int entries=0;
+    bool complete=false;
+    uint8_t header[4];
+    uint8_t trailer[4];
+    char key[256];
+    while(true){
+        int n=journal.read(header, sizeof(header));
+        if(n==0){
+            complete=true;
+            break;
+        }
+        if(n!=sizeof(header) || header[0]!=JOURNAL_MAGIC) break;
+        if(journal.read((uint8_t*)key, header[1])!=header[1]) break;
+        key[header[1]]=0;
+        uint32_t crc=crc32(0, header, sizeof(header));
+        crc=crc32(crc, (const uint8_t*)key, header[1]);
+
+        size_t val_len=header[2] | (header[3]<<8);
+        String val;
+        val.reserve(val_len);
+        while(val.length()<val_len){
+            int c=journal.read();
+            if(c<0) break;
+            val+=(char)c;
+        }
+        if(val.length()<val_len) break;
+        crc=crc32(crc, (const uint8_t*)val.c_str(), val_len);
+
+        if(journal.read(trailer, sizeof(trailer))!=sizeof(trailer)) break;
+        uint32_t stored=0;
+        for(uint8_t b=0; b<4; b++) stored|=(uint32_t)trailer[b]<<(8*b);
+        if(stored!=crc) break;
+
+        config.add(key, val);
+        entries++;
+    }
+    journal.close();
+
+    addLog((String)"Config journal: "+entries+" entries"+(complete ? "" : ", torn entry dropped"), false);
+    // nothing may be appended behind a torn entry, start over from a snapshot
+    if(!complete){
+        config_snapshot=true;
+        commitConfig();
+    }
+}
+
+
 void LHWeb::on(const char* uri, const char* channel, const char* command, THandlerFunction func){
-    httpd.on(uri, func);
+    // a profile per route, there may be hundreds so the rest shares one
+    const char* profile="on()";
+    if(route_profiles<ROUTE_PROFILES){
+        route_profiles++;
+        profile=uri;
+    }
+    router.on(uri, profiled(profile, func, RATE_CONTROL));
+    // set used to call every function of a channel and command, so a
+    // second registration is chained to the first instead of ignored
+    String key=(String)channel+"/"+command;
+    THandlerFunction *registered=commands.find(key.c_str());
+    if(registered){
+        THandlerFunction first=*registered;
+        *registered=[first, func](){ first(); func(); };
+    }else{
+        commands.on(key.c_str(), func);
+    }
     TelnetCmd *tel = new TelnetCmd();
     tel->channel = channel;
     tel->command = command;
@@ -1149,6 +3185,25 @@ void LHWeb::setTimer(unsigned long int delay, THandlerFunction func){
     timer_function=func;
 }
 
+String LHWeb::getParameter(const char* name){
+    return router.getParameter(name);
+}
+
+
+// /channel/<channel>/<command>, same as "set <channel> <command>"
+void LHWeb::handleChannel(){
+    String key=router.getParameter("ch")+"/"+router.getParameter("cmd");
+    THandlerFunction *func=commands.find(key.c_str());
+    if(func==NULL){
+        httpd.send(404, "text/plain", "ERROR command not registered\n");
+        return;
+    }
+    (*func)();
+    // unless the function answered itself
+    if(httpd.last_code==0) httpd.send(200, "text/plain", "OK\n");
+}
+
+
 String LHWeb::getParameter(){
     if(command_parameter!=""){
         return command_parameter;
@@ -1159,3 +3214,126 @@ String LHWeb::getParameter(){
     }
 }
 
+
+#ifdef LHWEB_BENCHMARK
+// runs func count times and appends the result line to out
+// heap_op is the heap kept per run, peak the largest drop
+// of the free heap seen between two runs
+void LHWeb::benchmark(String &out, const char* name, unsigned long count, std::function< void(unsigned long)> func){
+    uint32_t heap_start=ESP.getFreeHeap();
+    uint32_t heap_min=heap_start;
+    unsigned long start=micros();
+    for(unsigned long i=0; i<count; i++){
+        func(i);
+        uint32_t heap=ESP.getFreeHeap();
+        if(heap<heap_min) heap_min=heap;
+        yield();
+    }
+    unsigned long us=micros()-start;
+    long kept=(long)heap_start-(long)ESP.getFreeHeap();
+
+    out+="bench ";
+    out+=name;
+    out+=" n=";
+    out+=count;
+    out+=" ns_op=";
+    out+=(unsigned long)((unsigned long long)us*1000/count);
+    out+=" heap_op=";
+    out+=kept/(long)count;
+    out+=" peak=";
+    out+=heap_start-heap_min;
+    out+="\n";
+}
+
+
+String LHWeb::runBenchmarks(){
+    String out="";
+    const char* templates[]={"/index.tmpl", "/log.tmpl", "/browse.tmpl", "/userconfig.tmpl"};
+
+    // template rendering with the data the pages use
+    String rows="";
+    for(int i=0; i<log.size(); i++){
+        rows += String("<tr><td>")+log.get(i)+"</td></tr>\n";
+    }
+    for(uint8_t t=0; t<4; t++){
+        // from SPIFFS or the bundle, like parseTemplate() opens it
+        if(!lookupAsset(templates[t])) continue;
+        benchmark(out, templates[t], 20, [&](unsigned long){
+            LHConfig data("");
+            data.add("ssid", WiFi.SSID() );
+            data.add("ip", WiFi.localIP().toString() );
+            data.add("hostname", Hostname() );
+            data.add("log", rows);
+            data.add("file_list", rows);
+            data.add("userconfig", rows);
+            parseTemplate(templates[t], data);
+        });
+    }
+    benchmark(out, "parseTemplateString", 200, [&](unsigned long){
+        LHConfig data("");
+        data.add("ssid", "bench");
+        data.add("host", "lhweb");
+        parseTemplateString("<tr><td>SSID</td><td>{{ ssid }}</td></tr><tr><td>Host</td><td>{{host}}</td></tr>", data);
+    });
+
+    // log at a sustained rate, the log stays at its limit of 100 entries.
+    // The real log is put aside and restored afterwards, the entries
+    // are not broadcast so no WebSocket client sees them.
+    LinkedList<String> saved_log;
+    while(log.size()>0) saved_log.add(log.shift());
+    unsigned long saved_dropped=metrics.log_dropped;
+    benchmark(out, "addLog", 500, [&](unsigned long i){
+        appendLog(timeStamp()+" bench entry "+String(i));
+    });
+    log.clear();
+    while(saved_log.size()>0) log.add(saved_log.shift());
+    metrics.log_dropped=saved_dropped;
+
+    // command mix as sent by home automation scripts
+    // set only hits a channel that does not exist, so no device switches
+    const char* commands[]={"version", "rssi", "config wifi_hostname", "channel", "channel 0", "set bench on"};
+    benchmark(out, "processInput", 300, [&](unsigned long i){
+        processInput(commands[i%6]);
+    });
+
+    // set dispatch with many registered channels, they go to a router
+    // that stands in for the registered commands during the run
+    const int channels=300;
+    LHRouter *bench=new LHRouter();
+    for(int c=0; c<channels; c++){
+        char key[16];
+        sprintf(key, "b%d/on", c);
+        bench->on(key, [](){});
+        sprintf(key, "b%d/off", c);
+        bench->on(key, [](){});
+    }
+    this->commands.swap(*bench);
+    benchmark(out, "set", 300, [&](unsigned long i){
+        char cmd[16];
+        sprintf(cmd, "set b%lu off", (i*7)%channels);
+        processInput(cmd);
+    });
+    this->commands.swap(*bench);
+    delete bench;
+
+    // route lookup with many registered channels, in a router of its own
+    // so nothing stays registered afterwards
+    LHRouter *routes=new LHRouter();
+    for(int c=0; c<channels; c++){
+        char uri[24];
+        sprintf(uri, "/light/b%d/on", c);
+        routes->on(uri, [](){});
+        sprintf(uri, "/light/b%d/off", c);
+        routes->on(uri, [](){});
+    }
+    routes->on("/channel/{ch}/{cmd}", [](){});
+    benchmark(out, "route", 300, [&](unsigned long i){
+        char uri[24];
+        sprintf(uri, i&1 ? "/light/b%lu/off" : "/channel/b%lu/off", (i*7)%channels);
+        routes->find(uri);
+    });
+    delete routes;
+
+    return out;
+}
+#endif
@@ -7,6 +7,10 @@
 #include <ESP8266mDNS.h>
 #include <TimeLib.h> 
 #include <WiFiUdp.h>
+#include <StreamString.h>
+#include "lhdeflate.h"
+#include "lhwebsocket.h"
+#include "lhrouter.h"
 
 
 extern "C" {
@@ -22,8 +26,180 @@ extern "C" {
 }
 
 #define MAX_SRV_CLIENTS 10
+#define MAX_TASKS 12
+#define MAX_PROFILES 40            // stages, tasks and routes, the last one is shared
+#define ROUTE_PROFILES 8            // on() routes with a profile of their own
+#define PROFILE_BUCKETS 12
+#define METRICS_BUFFER 512
+#define CHUNK_BUFFER 512            // stack buffer for streamed responses
+#define HTTP_CLIENTS 4              // persistent HTTP connections
+#define HTTP_KEEPALIVE 5000         // ms an idle HTTP connection stays open
+#define HTTP_HEADER_MAX 1024        // request header searched for its end before parsing
+#define UPLOAD_BUFFER 512           // two SPIFFS pages
+#define TAR_BLOCK 512
+#define MAX_ASSETS 64               // size of the static file index, power of two
+#define ASSET_GZIP 0x01             // a gzip compressed <name>.gz exists as well
+#define ASSET_BUNDLE 0x02           // compiled into the firmware, see mkbundle.py
+#define MIME_COUNT 14
+#define CONFIG_JOURNAL "lhweb.jnl"  // no leading / like lhweb.conf, so no URI reaches it
+#define WIFI_CACHE "wifi.cache"     // no leading /, no URI reaches it
+// route classes for the rate limits
+#define RATE_STATIC 0
+#define RATE_DYNAMIC 1
+#define RATE_UPLOAD 2
+#define RATE_CONTROL 3
+#define RATE_CLASSES 4
+#define RATE_NONE 0xFF              // not limited by the profiled() wrapper
+#define RATE_CLIENTS 8              // remote addresses tracked at once
+#define ANNOUNCE_PORT 4210
+#define ANNOUNCE_CHANNELS 16        // channel states kept for the announcements
+#define ANNOUNCE_COALESCE 50        // ms state changes are collected before they go out
+#define WIFI_FAST_TRIES 15          // 200ms polls of a connect with the cached AP
+#define CONFIG_QUIET 2000           // ms without config changes before they get written
+#define JOURNAL_MAX 4096            // journal size that makes the next commit write a snapshot
+
+// uncomment to record heap usage per stage, handler and command
+//#define LHWEB_HEAP_TRACKING
+
+// uncomment to add the 'bench' command running the hot path benchmarks
+//#define LHWEB_BENCHMARK
 typedef std::function< void(void)> THandlerFunction;
 
+class LHWebServer;
+
+// collects output in a caller provided buffer and
+// hands it to the web server whenever the buffer is full.
+// Numbers, escaped and URL encoded text are written without
+// building temporary Strings.
+class LHWriter: public Print{
+  public:
+    LHWriter(LHWebServer &server, char* buf, size_t size);
+    // writes to another Print, without a buffer everything goes straight through
+    LHWriter(Print &out, char* buf=NULL, size_t size=0);
+    size_t write(uint8_t c);
+    size_t write(const uint8_t *data, size_t n);
+    using Print::write;
+    void flush();
+
+    // text with & < > " ' replaced, safe in elements and attribute values
+    size_t printEscaped(const char* str);
+    size_t printEscaped(const String& str){ return printEscaped(str.c_str()); }
+    // percent encodes everything but letters, digits and -_.~
+    size_t printUrlEncoded(const char* str);
+    size_t printUrlEncoded(const String& str){ return printUrlEncoded(str.c_str()); }
+    // 1536 -> "1K", like LHWeb::sizing()
+    size_t printSize(size_t value);
+  private:
+    LHWebServer *server=NULL;
+    Print *out=NULL;
+    char *buf;
+    size_t size;
+    size_t len=0;
+};
+
+// writes the content of a {{tag}} that is not in the template data
+typedef std::function< void(const String& tag, LHWriter &out)> TTemplateFunction;
+// moves a {{#name}}...{{/name}} section to its next row, row counts from 0.
+// Returns false when there are no more rows. The tags inside the section
+// are written by the TTemplateFunction, which knows the current row.
+typedef std::function< bool(const String& section, int row)> TSectionFunction;
+
+// read only file in program flash, used for the bundled web files
+class LHFlashFile: public Stream{
+  public:
+    LHFlashFile(const uint8_t* data=NULL, size_t size=0, const char* name="");
+    int available();
+    int read();
+    size_t read(uint8_t* buf, size_t n);
+    size_t readBytes(char* buf, size_t n){ return read((uint8_t*)buf, n); }
+    int peek();
+    void flush(){}
+    size_t write(uint8_t){ return 0; }
+    bool seek(size_t position);
+    size_t size(){ return len; }
+    const char* name(){ return file_name; }
+    operator bool(){ return data!=NULL; }
+  private:
+    const uint8_t *data;
+    size_t len;
+    size_t pos=0;
+    const char *file_name;
+};
+
+// web server that keeps track of what it sent.
+// ESP8266WebServer serves one connection at a time and closes it after
+// every response. This one keeps up to HTTP_CLIENTS connections open,
+// waits without blocking until a request header is complete and then
+// runs it through the usual handlers. Requests pipelined on a connection
+// are answered in order, one per connection and handleClient() call.
+// Responses are framed by Content-Length or chunked encoding so the
+// connection can be reused; the status line and headers are written here
+// instead of by the base class, which always sends "Connection: close".
+class LHWebServer: public ESP8266WebServer{
+  public:
+    int last_code=0;
+    unsigned long bytes_sent=0;
+    unsigned long connections=0;    // accepted
+    unsigned long reused=0;         // requests on an already used connection
+    unsigned long requests=0;       // read, numbers the current one from its first byte
+
+    LHWebServer(int port=80): ESP8266WebServer(port){}
+
+    void handleClient();
+    void close();
+    uint8_t connected();
+
+    void send(int code, const char* content_type = NULL, const String& content = String(""));
+    void send(int code, char* content_type, const String& content);
+    void send(int code, const String& content_type, const String& content);
+    void sendContent(const String& content);
+    // sends raw bytes without building a String first
+    void sendContent(const char* content, size_t len);
+    // "Connection: close" from a handler ends the connection after the response
+    void sendHeader(const String& name, const String& value, bool first = false);
+
+    template<typename T> size_t streamFile(T &file, const String& contentType){
+        String name=file.name();
+        if(name.endsWith(".gz") && contentType!="application/x-gzip" && contentType!="application/octet-stream"){
+            sendHeader("Content-Encoding", "gzip");
+        }
+        size_t size=file.size();
+        setContentLength(size);
+        send(200, contentType, "");
+        if(head) return 0;
+
+        char buf[CHUNK_BUFFER];
+        size_t sent=0;
+        while(sent<size){
+            size_t len=file.read((uint8_t*)buf, size-sent<sizeof(buf) ? size-sent : sizeof(buf));
+            if(len==0) break;
+            sendContent(buf, len);
+            sent+=len;
+        }
+        // the client waits for the promised length, only a close ends that
+        if(sent<size) keep_alive=false;
+        return sent;
+    }
+
+  private:
+    class Connection {
+    public:
+        WiFiClient tcp;
+        unsigned long last;         // millis() of the last request or the accept
+        unsigned long waiting;      // millis() since data is there, 0 if none
+        uint16_t requests;
+    };
+    Connection clients[HTTP_CLIENTS];
+    bool keep_alive=false;
+    bool head=false;                // HEAD request, the body is left out
+
+    void accept();
+    bool headerComplete(Connection &c);
+    void serve(Connection &c);
+    void drop(Connection &c);
+    void prepareHeader(String& response, int code, const char* content_type, size_t content_length);
+};
+
 class LHWeb{
   public:
     String mac_address="";
@@ -31,7 +207,7 @@ class LHWeb{
 
     LHConfig config;
     LinkedList<String> log;
-    ESP8266WebServer httpd;
+    LHWebServer httpd;
     
     class TelnetCmd {
     public:
@@ -40,10 +216,160 @@ class LHWeb{
         THandlerFunction func;
     };
     LinkedList<TelnetCmd*> telnet_commands;
+    // routes registered with on(), checked after the built-in pages
+    LHRouter router;
+
+    // entry of the in-RAM index of the files in SPIFFS
+    class Asset {
+    public:
+        uint32_t path_hash;         // 0 marks an empty slot
+        uint32_t size;
+        uint32_t crc;               // CRC32 of the content
+        uint8_t mime;               // index into the mime type table
+        uint8_t flags;
+    };
+    // file written under a temporary name in page aligned blocks,
+    // commit() renames it to its final path
+    class StagedFile {
+    public:
+        String path;
+        String tmp_path;
+        File file;
+        uint8_t *buf=NULL;
+        size_t len=0;
+        size_t size=0;
+        uint32_t crc=0;
+        bool error=false;
+        bool replaced=false;        // commit() found an old file
+
+        static String tmpPath(const String& target);
+        // where commit() puts the old file aside
+        static String oldPath(const String& target);
+        bool open(const String& target);
+        bool write(const uint8_t* data, size_t n);
+        bool flush();
+        bool close();
+        // keep_old leaves the old file at oldPath() for a rollback
+        bool commit(bool keep_old=false);
+        void abort();
+    };
+    StagedFile upload_file;
+
+    // file of a /deploy archive that is staged and waits for the rest
+    class DeployEntry {
+    public:
+        String path;
+        uint32_t size;
+        uint32_t crc;
+        bool replaced;              // an old file waits at its oldPath()
+    };
+
+    Asset assets[MAX_ASSETS];
+    uint8_t asset_count=0;
+    unsigned long cache_max_age[MIME_COUNT];
+    bool compress_pages=true;
     WiFiClient telnetClients[MAX_SRV_CLIENTS];
     WiFiServer telnetd;
+    // pushes "state <channel> <value>" and "log <entry>", takes telnet commands
+    LHWebSocket websocket;
     
     String command_parameter="";
+    // "<channel>/<command>" of everything registered with on(), used by set and /channel
+    LHRouter commands;
+
+    // cooperative task run by doWork()
+    class Task {
+    public:
+        const char* name;
+        THandlerFunction func;
+        uint8_t priority;           // lower value runs first
+        unsigned long interval;     // ms between two runs
+        unsigned long budget;       // us the task may use per run
+        unsigned long next_run;     // millis() when the task is due
+        unsigned long used;         // us used by the last run
+        unsigned long overruns;     // runs that took longer than budget
+        bool deferred;              // pushed out of the last pass
+        uint8_t profile;            // slot in profiles
+    };
+    Task tasks[MAX_TASKS];
+    uint8_t task_count=0;
+
+    // run time histogram of a stage or handler
+    class Profile {
+    public:
+        const char* name;
+        unsigned long count;
+        unsigned long total;        // us
+        unsigned long max;          // us
+        uint16_t hist[PROFILE_BUCKETS];
+    };
+    Profile profiles[MAX_PROFILES];
+    uint8_t profile_count=0;
+    uint8_t route_profiles=0;       // slots taken by on() routes
+
+    // longest doWork() pass above the stall threshold
+    class Stall {
+    public:
+        unsigned long when;         // millis()
+        unsigned long duration;     // us
+        const char* task;
+        const char* handler;
+        char uri[32];
+    };
+    Stall last_stall;
+    unsigned long stall_count=0;
+
+    // plain counters, exported by /metrics
+    class Metrics {
+    public:
+        unsigned long http_status[MAX_PROFILES][4];  // 2xx..5xx per route
+        unsigned long telnet_sessions;
+        unsigned long telnet_commands;
+        unsigned long ntp_syncs;
+        unsigned long ntp_failures;
+        long ntp_offset;                            // s, last correction
+        unsigned long log_dropped;
+        unsigned long uploads;
+        unsigned long upload_failures;
+        unsigned long upload_bytes;
+        unsigned long upload_rate;                  // B/s of the last upload
+        unsigned long config_commits;
+        unsigned long wifi_boot_ms;                 // boot until the first connection
+        unsigned long wifi_connect_ms;              // duration of the last connect
+        unsigned long wifi_fast_connects;           // connects with the cached AP
+        unsigned long wifi_reconnects;
+        unsigned long rate_limited[RATE_CLASSES];   // requests turned away
+        unsigned long config_snapshots;
+        unsigned long announcements;                // multicast datagrams sent
+    };
+    Metrics metrics;
+
+    // token buckets per remote address, one per route class, in
+    // thousandths of a request. The least recently seen address
+    // gives up its slot to a new one.
+    class RateBucket {
+    public:
+        uint32_t ip;
+        unsigned long last;
+        uint32_t tokens[RATE_CLASSES];
+    };
+    RateBucket rate_buckets[RATE_CLIENTS];
+    uint16_t rate_per_minute[RATE_CLASSES];
+    uint16_t rate_burst[RATE_CLASSES];
+
+#ifdef LHWEB_HEAP_TRACKING
+    // heap usage per profile slot
+    class HeapProfile {
+    public:
+        long live;                  // bytes allocated and not yet freed
+        unsigned long allocs;       // runs that left memory allocated
+        long peak;                  // largest delta of a single run
+        long last;                  // delta of the last run
+    };
+    HeapProfile heap_profiles[MAX_PROFILES];
+    uint32_t heap_min_free=0xFFFFFFFF;
+    uint32_t heap_min_block=0xFFFFFFFF;
+#endif
   private:
     uint8_t MAC_array[WL_MAC_ADDR_LENGTH];
     char MAC_char[4];
@@ -55,27 +381,134 @@ class LHWeb{
     
     int tries_reconnect=0;
 
+    // last good connection, lets connect() skip the scan and DHCP
+    class WifiCache {
+    public:
+        uint32_t network;           // CRC32 of SSID and password
+        uint8_t bssid[6];
+        int32_t channel;
+        uint32_t ip;
+        uint32_t gateway;
+        uint32_t mask;
+        uint32_t dns;
+        uint32_t crc;               // of everything above
+    };
+    WifiCache wifi_cache;
+    bool wifi_cached=false;
+
+    uint32_t networkHash();
+    void loadWifiCache();
+    void saveWifiCache();
+    bool waitForWifi(int tries);
+
     // Things for NTP
     WiFiUDP Udp;
     unsigned int localUdpPort = 8888;
     #define NTP_PACKET_SIZE  48
     byte packetBuffer[NTP_PACKET_SIZE];
 
+    // multicast announcements of the channel states, off without announce_group
+    WiFiUDP announce_udp;
+    IPAddress announce_group;
+    uint16_t announce_port=ANNOUNCE_PORT;
+    unsigned long announce_interval=30000;      // ms between heartbeats
+    unsigned long announce_changed=0;           // first unsent change, 0 if none
+    unsigned long announce_heartbeat=0;
+    uint32_t announce_seq=0;
+    class ChannelState {
+    public:
+        String channel;
+        String state;
+        bool dirty;                 // changed since the last datagram
+        unsigned long changed;      // millis() of the last change
+    };
+    ChannelState announce_states[ANNOUNCE_CHANNELS];
+    uint8_t announce_count=0;
+
+    void announceState(const char* channel, const char* state);
+    void handleAnnounce();
+    void sendAnnouncement(bool heartbeat);
+
     String uploadError;
-    File fsUploadFile;
+    unsigned long upload_limited=0; // httpd.requests of the upload over the limit
+    unsigned long upload_start=0;
+
+    // state of a running /deploy
+    StagedFile deploy_file;
+    LinkedList<DeployEntry*> deploy_files;
+    String deploy_error;
+    uint8_t *deploy_header=NULL;
+    size_t deploy_header_len=0;
+    size_t deploy_left=0;           // data of the current file still to come
+    size_t deploy_skip=0;           // padding or skipped entries
+    size_t deploy_padding=0;
+    bool deploy_done=false;
+
+    void deployData(const uint8_t* data, size_t n);
+    void deployHeader();
+    void deployFileDone();
+    void deployAbort();
+    void deployReset();
 
     unsigned long last_time_sync=0;
+    unsigned long ntp_request_time=0;
 
     String serial_input_string="";
     bool serial_input_complete=false;
     
     unsigned long int timer_time=0;
     THandlerFunction timer_function=NULL;
+
+    // scheduler state
+    unsigned long pass_budget=20000;
+    Task *current_task=NULL;
+    unsigned long task_start=0;
+    uint8_t telnet_next_client=0;
+
+    // profiler state of the running pass
+    unsigned long stall_threshold=100000;
+    const char* pass_task=NULL;
+    unsigned long pass_task_us=0;
+    const char* pass_handler=NULL;
+    unsigned long pass_handler_us=0;
+    char pass_uri[32];
+    uint8_t profile_template=0;
+    uint8_t profile_config=0;
+    uint8_t profile_log=0;
+    uint8_t profile_command=0;
+    uint8_t profile_journal=0;
+
+    // config keys changed since the last commit
+    LinkedList<String> config_pending;
+    unsigned long config_changed=0;
+    bool config_snapshot=false;     // the next commit rewrites lhweb.conf
+
+    void runTask(Task &task);
+    time_t parseNtpPacket();
+    void handleNtp();
+    void handleWifi();
+    void handleSerial();
+    void handleTelnet();
+    void handleTimer();
+    void recordStall(unsigned long duration);
+    bool saveConfig();
+    void handleConfig();
+    void replayJournal();
+    void syncTime(time_t t);
+    void metricsPrintf(char* buf, size_t &len, const char* fmt, ...);
+    // adds a finished entry to the log without telling anyone
+    void appendLog(const String& entry);
+    void renderStream(Stream *in, const char* str, LHConfig &data, Print &out, TTemplateFunction tags, TSectionFunction sections);
+#ifdef LHWEB_HEAP_TRACKING
+    void heapRecord(uint8_t slot, uint32_t before);
+#endif
   public:
 
     // Constructor - inits config and web server as well
     LHWeb(bool dbg=false);
     void begin();
+    // the templates are compiled in now, this only rebuilds the index
+    // of the files in SPIFFS, eg after the sketch wrote some itself
     void checkFiles();
     String SSID();
     void SSID(String ssid);
@@ -88,6 +521,12 @@ class LHWeb{
     int TimeZone();
     void TimeZone(int tz);
 
+    // changes a config setting, the change is appended to the config
+    // journal once there were no further changes for CONFIG_QUIET ms
+    void setConfig(const String& key, const String& val);
+    // writes pending changes now, returns false if flash could not be written
+    bool commitConfig();
+
     // Read MAC address and stor in varialbles (mac_address and short_mac)
     void readMacAddress();
 
@@ -108,7 +547,49 @@ class LHWeb{
     // checks to see if we are still conencted to the wifi network
     // if conenction was lost it will try to reconnect
     // also handles all client requests.
-    void doWork();
+    // Runs every due task once and returns the millis() time at which
+    // the next task gets due, so the caller may sleep until then.
+    unsigned long doWork();
+
+    // register a task for doWork()
+    // name - used to find the task again, eg in setTaskInterval()
+    // priority - tasks with lower values run first
+    // interval - ms between two runs, 0 runs it on every pass
+    // budget - us the task should use per run
+    bool addTask(const char* name, THandlerFunction func, uint8_t priority=100, unsigned long interval=0, unsigned long budget=2000);
+    Task* getTask(const char* name);
+    void setTaskInterval(const char* name, unsigned long interval);
+    void setTaskBudget(const char* name, unsigned long budget);
+
+    // us a single doWork() pass may take before due tasks
+    // with lower priority get deferred to the next pass
+    void setPassBudget(unsigned long budget);
+
+    // true as long as the running task is within its budget
+    bool taskBudgetLeft();
+
+    // returns the profile slot for the given name, creates it if needed
+    // when all slots are in use the last one collects everything else
+    uint8_t profileSlot(const char* name);
+    void profileRecord(uint8_t slot, unsigned long us);
+    // wraps a handler so its run time is recorded under the given name,
+    // HTTP requests over the rate limit of route_class get a 429 instead
+    THandlerFunction profiled(const char* name, THandlerFunction func, uint8_t route_class=RATE_DYNAMIC);
+    // requests per minute and burst size of a route class, 0 turns the
+    // limit off. Can also be set with the config keys rate_<class>,
+    // eg "rate_dynamic 120 10"
+    void setRateLimit(uint8_t route_class, uint16_t per_minute, uint16_t burst);
+    // takes a token from the bucket of the address, false if it is empty
+    bool admit(uint32_t ip, uint8_t route_class);
+    bool admitRequest(uint8_t route_class);
+    void sendTooManyRequests();
+    // passes of doWork() taking longer than this (us) are logged as stalls
+    void setStallThreshold(unsigned long us);
+    String stats();
+    String heapStats();
+    void resetStats();
+    void handleStats();
+    void handleMetrics();
 
     // callback function for time synchronization
     time_t getNtpTime();
@@ -118,7 +599,10 @@ class LHWeb{
 
 
     // register urls and telnet commands to local functions
-    // uri - web uri eg "/lighton"
+    // uri - web uri eg "/lighton", or a pattern like "/light/{ch}/on",
+    //       see getParameter(name). /channel/<channel>/<command> calls
+    //       the function as well. The first function of an uri wins,
+    //       set and /channel call all of a channel and command
     // function - pointer to a function to call
     // channel - the channel number of the device.
     // set - the telnet command to react to
@@ -129,26 +613,66 @@ class LHWeb{
     void addLog(String entry, bool remote=true);
 
     void handle404();
+    int parseRange(const String& header, size_t size, size_t &start, size_t &end);
+    void streamRange(Stream &in, size_t size, const char* content_type, size_t start, size_t end);
 
     String parseTemplate(String html_file, LHConfig &data);
     String parseTemplateString(String tmpl_str, LHConfig &data);
+    void renderTemplate(Stream *in, const char* str, LHConfig &data, Print &out, TTemplateFunction tags=NULL, TSectionFunction sections=NULL);
+    // renders a template directly into a 200 response
+    void sendTemplate(String html_file, LHConfig &data, TTemplateFunction tags=NULL, TSectionFunction sections=NULL);
+    // gzip generated pages for clients that accept it (config key http_compress)
+    void compressPages(bool compress);
 
     void handleRoot();
     void handleWebConfig();
     void handleLog();
     void redirect(String uri);
     void handleUserConfig();
+    void userConfigRow(LHWriter &out, int i, const char* key, const char* val);
     void handleReset();
     String string2hex(String in);
     void fileUpload();
     void onUpload();
+    void deployUpload();
+    void onDeploy();
 
     void dumpFileList();
     void dumpFile(String file_name);
 
     String getContentType(String filename);
+    uint8_t mimeType(const String& filename);
+    static uint32_t pathHash(const String& path);
+    static uint32_t crc32(uint32_t crc, const uint8_t* buf, size_t len);
+
+    // static file index, built by begin() and kept up to date by
+    // uploads, deletes and format. Files written by the sketch itself
+    // have to be added with indexAsset() to be served, files that do
+    // not fit into a full index are not served at all.
+    void indexAssets();
+    Asset* indexAsset(const String& path);
+    Asset* indexAsset(const String& path, uint32_t size, uint32_t crc);
+    void unindexAsset(const String& path);
+    Asset* findAsset(const String& path);
+    // bundled copy of a file, NULL if there is none or
+    // the file or its .gz variant is in SPIFFS
+    const Asset* findBundled(const String& path);
+    // file from the index, or the bundled copy if SPIFFS has none
+    const Asset* lookupAsset(const String& path);
+    LHFlashFile openBundled(const Asset *asset);
+    // template from SPIFFS or the bundle, NULL if neither has it
+    Stream* openTemplate(const String& path, File &file, LHFlashFile &flash);
+    bool acceptsGzip();
+
+    // Cache-Control max-age for static files with the given
+    // extension (eg ".css"), 0 makes browsers revalidate every time.
+    // Can also be set with the config keys http_cache_<ext>.
+    void setCacheMaxAge(const char* extension, unsigned long seconds);
+    String cacheControl(uint8_t mime);
     void handleBrowse();
     void handleFormat();
+    void handleManifest();
+    void handleChannel();
 
     void resetConfigToDefaults();
 
@@ -166,6 +690,15 @@ class LHWeb{
     void setTimer(unsigned long int delay, THandlerFunction func);
     
     String getParameter();
+    // value of a {name} segment of the uri pattern that matched
+    String getParameter(const char* name);
+
+#ifdef LHWEB_BENCHMARK
+    // runs the benchmarks, one line per case:
+    // bench <name> n=<runs> ns_op=<ns> heap_op=<bytes> peak=<bytes>
+    String runBenchmarks();
+    void benchmark(String &out, const char* name, unsigned long count, std::function< void(unsigned long)> func);
+#endif
 };
 
 
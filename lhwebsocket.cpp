@@ -0,0 +1,256 @@
+#include "lhwebsocket.h"
+#include <Hash.h>
+#include <base64.h>
+
+#define WS_TEXT 0x1
+#define WS_CLOSE 0x8
+#define WS_PING 0x9
+#define WS_PONG 0xA
+
+static const char* websocket_guid="258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+
+
+LHWebSocket::LHWebSocket(int port): server(port){
+    for(uint8_t i=0; i<WEBSOCKET_CLIENTS; i++){
+        clients[i].open=false;
+        clients[i].rx_len=0;
+    }
+}
+
+
+void LHWebSocket::begin(){
+    server.begin();
+    server.setNoDelay(true);
+}
+
+
+void LHWebSocket::onMessage(TWebSocketFunction func){
+    message_func=func;
+}
+
+
+void LHWebSocket::handle(){
+    if(server.hasClient()){
+        WiFiClient tcp=server.available();
+        for(uint8_t i=0; i<WEBSOCKET_CLIENTS; i++){
+            Client &c=clients[i];
+            if(!c.tcp || !c.tcp.connected()){
+                if(c.tcp) c.tcp.stop();
+                c.tcp=tcp;
+                c.open=false;
+                c.request="";
+                c.rx_len=0;
+                tcp=WiFiClient();
+                break;
+            }
+        }
+        //no free spot
+        if(tcp) tcp.stop();
+    }
+
+    for(uint8_t i=0; i<WEBSOCKET_CLIENTS; i++){
+        Client &c=clients[i];
+        if(!c.tcp) continue;
+        if(!c.tcp.connected()){
+            close(c);
+        }else if(c.tcp.available()){
+            if(c.open){
+                receive(i);
+            }else{
+                handshake(c);
+            }
+        }
+    }
+}
+
+
+// collects the upgrade request and answers it once the header is complete
+void LHWebSocket::handshake(Client &c){
+    while(c.tcp.available() && c.request.length()<WEBSOCKET_HANDSHAKE){
+        c.request+=(char)c.tcp.read();
+    }
+    if(!c.request.endsWith("\r\n\r\n")){
+        if(c.request.length()>=WEBSOCKET_HANDSHAKE) close(c);
+        return;
+    }
+
+    String key="";
+    String lower=c.request;
+    lower.toLowerCase();
+    int pos=lower.indexOf("\r\nsec-websocket-key:");
+    if(pos>=0){
+        int end=c.request.indexOf("\r\n", pos+2);
+        key=c.request.substring(pos+20, end);
+        key.trim();
+    }
+    c.request="";
+    if(key.length()==0){
+        c.tcp.print("HTTP/1.1 400 Bad Request\r\nConnection: close\r\n\r\n");
+        close(c);
+        return;
+    }
+
+    key+=websocket_guid;
+    uint8_t hash[20];
+    sha1((const uint8_t*)key.c_str(), key.length(), hash);
+
+    // some core versions end the encoded text with a line break
+    String accept=base64::encode(hash, 20);
+    accept.trim();
+
+    c.tcp.print((String)"HTTP/1.1 101 Switching Protocols\r\n"
+        "Upgrade: websocket\r\n"
+        "Connection: Upgrade\r\n"
+        "Sec-WebSocket-Accept: "+accept+"\r\n\r\n");
+    c.open=true;
+    sessions++;
+}
+
+
+// reads what is there and handles every complete frame in the buffer
+void LHWebSocket::receive(uint8_t i){
+    Client &c=clients[i];
+    while(c.tcp.available() && c.rx_len<WEBSOCKET_RX){
+        c.rx_len+=c.tcp.read(c.rx+c.rx_len, WEBSOCKET_RX-c.rx_len);
+    }
+
+    while(c.rx_len>=2){
+        uint8_t opcode=c.rx[0] & 0x0F;
+        bool fin=c.rx[0] & 0x80;
+        bool masked=c.rx[1] & 0x80;
+        size_t len=c.rx[1] & 0x7F;
+        size_t header=2;
+        if(len==126){
+            if(c.rx_len<4) return;
+            len=(size_t)c.rx[2]<<8 | c.rx[3];
+            header=4;
+        }else if(len==127){
+            // far beyond anything we accept
+            close(c);
+            return;
+        }
+        if(masked) header+=4;
+        // clients always mask, fragments and long messages are not supported
+        if(!masked || !fin || header+len>WEBSOCKET_RX){
+            close(c);
+            return;
+        }
+        if(c.rx_len<header+len) return;
+
+        uint8_t *payload=c.rx+header;
+        for(size_t n=0; n<len; n++) payload[n]^=c.rx[header-4+(n&3)];
+
+        if(opcode==WS_TEXT){
+            messages++;
+            if(message_func){
+                String message;
+                message.reserve(len);
+                for(size_t n=0; n<len; n++) message+=(char)payload[n];
+                message_func(i, message);
+            }
+        }else if(opcode==WS_PING){
+            sendFrame(c, WS_PONG, payload, len);
+        }else if(opcode==WS_CLOSE){
+            sendFrame(c, WS_CLOSE, payload, len<2 ? len : 2);
+            close(c);
+            return;
+        }
+
+        // the callback may have closed the connection
+        if(!c.tcp) return;
+        c.rx_len-=header+len;
+        memmove(c.rx, c.rx+header+len, c.rx_len);
+    }
+}
+
+
+size_t LHWebSocket::frameHeader(uint8_t *buf, uint8_t opcode, size_t len){
+    buf[0]=0x80 | opcode;
+    if(len<126){
+        buf[1]=len;
+        return 2;
+    }
+    buf[1]=126;
+    buf[2]=(len>>8) & 0xFF;
+    buf[3]=len & 0xFF;
+    return 4;
+}
+
+
+void LHWebSocket::sendFrame(Client &c, uint8_t opcode, const uint8_t* payload, size_t len){
+    uint8_t header[4];
+    size_t n=frameHeader(header, opcode, len);
+    c.tcp.write(header, n);
+    if(len>0) c.tcp.write(payload, len);
+}
+
+
+void LHWebSocket::send(uint8_t client, const String& message){
+    Client &c=clients[client];
+    if(!c.open) return;
+    sendFrame(c, WS_TEXT, (const uint8_t*)message.c_str(), message.length());
+}
+
+
+void LHWebSocket::broadcast(const char* prefix, const String& message){
+    broadcast(prefix, message.c_str(), message.length());
+}
+
+
+void LHWebSocket::broadcast(const char* prefix, const char* message, size_t len){
+    if(connected()==0) return;
+    if(len>0xFFFF) len=0xFFFF;
+
+    size_t prefix_len= prefix ? strlen(prefix)+1 : 0;
+    size_t payload=prefix_len+len;
+    if(payload>0xFFFF){
+        len=0xFFFF-prefix_len;
+        payload=0xFFFF;
+    }
+
+    // one frame for everybody, only very long messages need a second write
+    size_t n=frameHeader(tx, WS_TEXT, payload);
+    if(prefix){
+        memcpy(tx+n, prefix, prefix_len-1);
+        tx[n+prefix_len-1]=' ';
+        n+=prefix_len;
+    }
+    size_t inline_len= n+len<=WEBSOCKET_TX ? len : 0;
+    memcpy(tx+n, message, inline_len);
+    n+=inline_len;
+
+    for(uint8_t i=0; i<WEBSOCKET_CLIENTS; i++){
+        Client &c=clients[i];
+        if(!c.open || !c.tcp.connected()) continue;
+        // a slow client misses the message instead of stalling the loop
+        if(c.tcp.availableForWrite() < n+len-inline_len){
+            dropped++;
+            continue;
+        }
+        c.tcp.write(tx, n);
+        if(inline_len<len) c.tcp.write((const uint8_t*)message, len);
+    }
+}
+
+
+uint8_t LHWebSocket::connected(){
+    uint8_t n=0;
+    for(uint8_t i=0; i<WEBSOCKET_CLIENTS; i++){
+        if(clients[i].open) n++;
+    }
+    return n;
+}
+
+
+IPAddress LHWebSocket::remoteIP(uint8_t client){
+    return clients[client].tcp.remoteIP();
+}
+
+
+void LHWebSocket::close(Client &c){
+    c.tcp.stop();
+    c.tcp=WiFiClient();
+    c.open=false;
+    c.request="";
+    c.rx_len=0;
+}
@@ -0,0 +1,60 @@
+#ifndef LHWEBSOCKET_H
+#define LHWEBSOCKET_H
+
+#include <Arduino.h>
+#include <ESP8266WiFi.h>
+#include <functional>
+
+#define WEBSOCKET_CLIENTS 10
+#define WEBSOCKET_RX 128            // longest frame accepted from a client
+#define WEBSOCKET_TX 256            // frames up to this size go out in one write
+#define WEBSOCKET_HANDSHAKE 1024    // longest upgrade request
+
+typedef std::function<void(uint8_t client, const String& message)> TWebSocketFunction;
+
+// Minimal WebSocket server (RFC 6455) for short text messages.
+// Outgoing frames are built once in a fixed buffer and written to
+// every open connection. Incoming messages have to fit into one
+// unfragmented frame of WEBSOCKET_RX bytes.
+class LHWebSocket{
+  public:
+    unsigned long sessions=0;
+    unsigned long messages=0;
+    unsigned long dropped=0;        // broadcasts skipped for clients with a full send buffer
+
+    LHWebSocket(int port=81);
+    void begin();
+    // accepts connections, answers handshakes and reads messages
+    void handle();
+    // called with every text message a client sends
+    void onMessage(TWebSocketFunction func);
+    // sends one text frame "<prefix> <message>" (or just message if
+    // prefix is NULL) to every open connection
+    void broadcast(const char* prefix, const char* message, size_t len);
+    void broadcast(const char* prefix, const String& message);
+    void send(uint8_t client, const String& message);
+    uint8_t connected();
+    IPAddress remoteIP(uint8_t client);
+
+  private:
+    class Client {
+    public:
+        WiFiClient tcp;
+        bool open;                  // handshake done
+        String request;             // upgrade request while the handshake is running
+        uint8_t rx[WEBSOCKET_RX];
+        size_t rx_len;
+    };
+    WiFiServer server;
+    Client clients[WEBSOCKET_CLIENTS];
+    uint8_t tx[WEBSOCKET_TX];
+    TWebSocketFunction message_func=NULL;
+
+    void handshake(Client &c);
+    void receive(uint8_t i);
+    void sendFrame(Client &c, uint8_t opcode, const uint8_t* payload, size_t len);
+    size_t frameHeader(uint8_t *buf, uint8_t opcode, size_t len);
+    void close(Client &c);
+};
+
+#endif
@@ -0,0 +1,310 @@
+#!/usr/bin/env python3
+"""Load generator for LHWeb nodes.
+
+Drives one node with a mix of HTTP requests and telnet commands and
+reports throughput and p50/p99/p999 latency per request kind.
+
+  ./loadgen.py 192.168.1.50 --mix root=5,css=3,showlog=1,set=10 --rate 20 --duration 30
+  ./loadgen.py 192.168.1.50 --mix root=5,set=10 --record run.trace
+  ./loadgen.py 192.168.1.50 --replay run.trace --json result.json
+  ./loadgen.py 192.168.1.50 --mix root=5,set=10 --compare
+  ./loadgen.py 192.168.1.50 --bench --json bench.json
+
+Request kinds:
+  root     GET /
+  showlog  GET /showlog
+  css      GET /w3.css
+  upload   POST /upload with a small file (/loadgen.txt)
+  set      telnet 'set <channel> <command>'
+
+Requests are sent open loop on a precomputed schedule, so a slow node
+shows up as latency instead of a lower request rate. Latency is taken
+from the scheduled send time. A schedule can be written with --record
+and replayed with --replay to repeat a run exactly.
+
+--compare runs the HTTP part, the telnet part and both together and
+prints the three reports, which shows whether one protocol is starved
+while the node serves the other one.
+"""
+
+import argparse
+import http.client
+import json
+import math
+import queue
+import random
+import socket
+import sys
+import threading
+import time
+from collections import defaultdict
+from concurrent.futures import ThreadPoolExecutor
+
+HTTP_PATHS = {'root': '/', 'showlog': '/showlog', 'css': '/w3.css'}
+TELNET_KINDS = ('set',)
+UPLOAD_BODY = b'loadgen upload test\n' * 50
+
+
+def parse_mix(text):
+    mix = {}
+    for item in text.split(','):
+        kind, _, weight = item.partition('=')
+        if kind not in HTTP_PATHS and kind not in TELNET_KINDS and kind != 'upload':
+            sys.exit('unknown request kind: ' + kind)
+        mix[kind] = float(weight or 1)
+    return mix
+
+
+def build_schedule(mix, rate, duration, channels, commands, seed):
+    """Poisson arrivals at the given total rate, kinds drawn by weight."""
+    rnd = random.Random(seed)
+    kinds = list(mix)
+    weights = [mix[k] for k in kinds]
+    schedule = []
+    t = 0.0
+    while True:
+        t += rnd.expovariate(rate)
+        if t >= duration:
+            return schedule
+        kind = rnd.choices(kinds, weights)[0]
+        if kind == 'set':
+            arg = 'set %s %s' % (rnd.choice(channels), rnd.choice(commands))
+        elif kind == 'upload':
+            arg = '/upload'
+        else:
+            arg = HTTP_PATHS[kind]
+        schedule.append((t, kind, arg))
+
+
+def save_trace(path, schedule):
+    with open(path, 'w') as f:
+        for t, kind, arg in schedule:
+            f.write('%.6f %s %s\n' % (t, kind, arg))
+
+
+def load_trace(path):
+    schedule = []
+    with open(path) as f:
+        for line in f:
+            line = line.strip()
+            if not line or line.startswith('#'):
+                continue
+            t, kind, arg = line.split(' ', 2)
+            schedule.append((float(t), kind, arg))
+    return schedule
+
+
+class TelnetPool:
+    """Fixed number of telnet sessions, one command in flight per session.
+
+    The node reads whatever is in the socket as one command, so a
+    session must wait for the answer before it sends the next line.
+    """
+
+    def __init__(self, host, port, size, timeout):
+        self.free = queue.Queue()
+        for _ in range(size):
+            self.free.put(self._open(host, port, timeout))
+        self.host, self.port, self.timeout = host, port, timeout
+
+    def _open(self, host, port, timeout):
+        sock = socket.create_connection((host, port), timeout)
+        sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+        return sock
+
+    def command(self, line):
+        sock = self.free.get()
+        try:
+            sock.sendall(line.encode() + b'\n')
+            answer = b''
+            while not answer.endswith(b'\n'):
+                chunk = sock.recv(512)
+                if not chunk:
+                    raise ConnectionError('telnet session closed')
+                answer += chunk
+            if not answer.startswith(b'OK'):
+                raise RuntimeError(answer.decode(errors='replace').strip())
+        except Exception:
+            sock.close()
+            sock = self._open(self.host, self.port, self.timeout)
+            raise
+        finally:
+            self.free.put(sock)
+
+    def close(self):
+        while not self.free.empty():
+            self.free.get().close()
+
+
+def http_request(host, port, method, path, timeout):
+    conn = http.client.HTTPConnection(host, port, timeout=timeout)
+    try:
+        if method == 'POST':
+            boundary = 'loadgenboundary'
+            body = (b'--' + boundary.encode() + b'\r\n'
+                    b'Content-Disposition: form-data; name="file"; filename="/loadgen.txt"\r\n'
+                    b'Content-Type: text/plain\r\n\r\n' + UPLOAD_BODY +
+                    b'\r\n--' + boundary.encode() + b'--\r\n')
+            conn.request('POST', path, body,
+                         {'Content-Type': 'multipart/form-data; boundary=' + boundary})
+        else:
+            conn.request('GET', path, headers={'Accept-Encoding': 'gzip'})
+        resp = conn.getresponse()
+        data = resp.read()
+        if resp.status >= 400:
+            raise RuntimeError('HTTP %d' % resp.status)
+        return len(data)
+    finally:
+        conn.close()
+
+
+def run(schedule, args, kinds=None):
+    if kinds is not None:
+        schedule = [op for op in schedule if op[1] in kinds]
+    latencies = defaultdict(list)
+    errors = defaultdict(int)
+    received = defaultdict(int)
+    lock = threading.Lock()
+    pool = None
+    if any(kind in TELNET_KINDS for _, kind, _ in schedule):
+        pool = TelnetPool(args.host, args.telnet_port, args.telnet_clients, args.timeout)
+
+    def execute(due, kind, arg):
+        try:
+            if kind in TELNET_KINDS:
+                pool.command(arg)
+                size = 0
+            elif kind == 'upload':
+                size = http_request(args.host, args.http_port, 'POST', arg, args.timeout)
+            else:
+                size = http_request(args.host, args.http_port, 'GET', arg, args.timeout)
+            with lock:
+                latencies[kind].append(time.monotonic() - due)
+                received[kind] += size
+        except Exception:
+            with lock:
+                errors[kind] += 1
+
+    start = time.monotonic()
+    with ThreadPoolExecutor(args.workers) as ex:
+        for t, kind, arg in schedule:
+            due = start + t
+            delay = due - time.monotonic()
+            if delay > 0:
+                time.sleep(delay)
+            ex.submit(execute, due, kind, arg)
+    elapsed = time.monotonic() - start
+    if pool:
+        pool.close()
+    return summarize(latencies, errors, received, elapsed)
+
+
+def percentile(values, p):
+    if not values:
+        return 0.0
+    return values[max(0, math.ceil(p * len(values)) - 1)]
+
+
+def summarize(latencies, errors, received, elapsed):
+    result = {'elapsed_s': round(elapsed, 3), 'kinds': {}}
+    for kind in sorted(set(latencies) | set(errors)):
+        values = sorted(latencies[kind])
+        result['kinds'][kind] = {
+            'ok': len(values),
+            'errors': errors[kind],
+            'per_s': round(len(values) / elapsed, 2),
+            'bytes': received[kind],
+            'p50_ms': round(percentile(values, 0.50) * 1000, 2),
+            'p99_ms': round(percentile(values, 0.99) * 1000, 2),
+            'p999_ms': round(percentile(values, 0.999) * 1000, 2),
+        }
+    return result
+
+
+def print_report(title, result):
+    print('%s (%.1f s)' % (title, result['elapsed_s']))
+    print('  %-8s %7s %6s %8s %9s %9s %9s' % ('kind', 'ok', 'err', 'per_s', 'p50_ms', 'p99_ms', 'p999_ms'))
+    for kind, r in result['kinds'].items():
+        print('  %-8s %7d %6d %8.2f %9.2f %9.2f %9.2f' % (
+            kind, r['ok'], r['errors'], r['per_s'], r['p50_ms'], r['p99_ms'], r['p999_ms']))
+
+
+def run_bench(args):
+    """Runs the 'bench' command of a node built with LHWEB_BENCHMARK."""
+    sock = socket.create_connection((args.host, args.telnet_port), args.timeout)
+    sock.sendall(b'bench\n')
+    sock.settimeout(60)
+    data = b''
+    while True:
+        try:
+            chunk = sock.recv(1024)
+        except socket.timeout:
+            break
+        if not chunk:
+            break
+        data += chunk
+        sock.settimeout(2)
+    sock.close()
+    cases = {}
+    for line in data.decode(errors='replace').splitlines():
+        fields = line.split()
+        if len(fields) < 3 or fields[0] != 'bench':
+            continue
+        cases[fields[1]] = {k: int(v) for k, v in (f.split('=') for f in fields[2:])}
+    return {'time': int(time.time()), 'host': args.host, 'bench': cases}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('host')
+    parser.add_argument('--http-port', type=int, default=80)
+    parser.add_argument('--telnet-port', type=int, default=23)
+    parser.add_argument('--mix', default='root=5,css=3,showlog=1,set=10')
+    parser.add_argument('--rate', type=float, default=10, help='requests per second (all kinds)')
+    parser.add_argument('--duration', type=float, default=30, help='seconds')
+    parser.add_argument('--channels', default='0', help='channels used by set, comma separated')
+    parser.add_argument('--commands', default='on,off', help='commands used by set, comma separated')
+    parser.add_argument('--telnet-clients', type=int, default=4, help='concurrent telnet sessions')
+    parser.add_argument('--workers', type=int, default=16, help='requests in flight at most')
+    parser.add_argument('--timeout', type=float, default=10)
+    parser.add_argument('--seed', type=int, default=1)
+    parser.add_argument('--record', help='write the schedule to this trace file')
+    parser.add_argument('--replay', help='replay a recorded trace file')
+    parser.add_argument('--compare', action='store_true', help='run HTTP only, telnet only and both')
+    parser.add_argument('--bench', action='store_true', help='collect the on-device benchmarks')
+    parser.add_argument('--json', help='write the results to this file')
+    args = parser.parse_args()
+
+    if args.bench:
+        result = run_bench(args)
+        for name, case in result['bench'].items():
+            print('%-20s %s' % (name, ' '.join('%s=%d' % kv for kv in case.items())))
+    else:
+        if args.replay:
+            schedule = load_trace(args.replay)
+        else:
+            schedule = build_schedule(parse_mix(args.mix), args.rate, args.duration,
+                                      args.channels.split(','), args.commands.split(','), args.seed)
+        if args.record:
+            save_trace(args.record, schedule)
+
+        if args.compare:
+            http_kinds = set(HTTP_PATHS) | {'upload'}
+            result = {
+                'http': run(schedule, args, http_kinds),
+                'telnet': run(schedule, args, set(TELNET_KINDS)),
+                'mixed': run(schedule, args),
+            }
+            for title, r in result.items():
+                print_report(title, r)
+        else:
+            result = run(schedule, args)
+            print_report('load', result)
+
+    if args.json:
+        with open(args.json, 'w') as f:
+            json.dump(result, f, indent=2)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,223 @@
+#!/usr/bin/env python3
+"""Generates lhbundle.h, the web files compiled into the firmware.
+
+  ./mkbundle.py
+
+The templates and w3.css are stored in program flash together with
+their size, CRC32 (the ETag) and mime type, static files get a gzip
+compressed <name>.gz variant as well. A node serves them as long as
+there is no file of the same name in SPIFFS, so a freshly flashed node
+shows the full UI before anything was uploaded.
+
+Before that the files go through a small asset build: w3.css loses
+every rule that only applies to w3-* classes which appear neither in a
+template nor in the markup generated by lhweb.cpp, then CSS and
+templates are minified. --full skips this step. --tar writes the same
+files as an archive for the /deploy endpoint.
+
+Run it after changing a template, w3.css or the markup in lhweb.cpp
+and commit lhbundle.h.
+"""
+
+import argparse
+import gzip
+import io
+import os
+import re
+import tarfile
+import zlib
+
+STATIC_FILES = ['w3.css']
+TEMPLATES = ['index.tmpl', 'webconfig.tmpl', 'browse.tmpl', 'log.tmpl', 'userconfig.tmpl']
+
+# files scanned for the w3-* classes that are in use
+MARKUP_SOURCES = TEMPLATES + ['lhweb.cpp']
+W3_CLASS = re.compile(r'w3-[0-9a-zA-Z_-]+')
+
+# same order as mime_extensions in lhweb.cpp, the index is stored in the asset
+MIME_EXTENSIONS = ['', '.htm', '.html', '.css', '.js',
+                   '.png', '.gif', '.jpg', '.ico', '.svg',
+                   '.xml', '.pdf', '.zip', '.gz']
+ASSET_GZIP = 0x01
+ASSET_BUNDLE = 0x02
+
+
+def path_hash(path):
+    """FNV-1a like LHWeb::pathHash(), 0 is reserved for empty slots."""
+    h = 2166136261
+    for c in path.encode():
+        h = ((h ^ c) * 16777619) & 0xFFFFFFFF
+    return h or 1
+
+
+def mime_type(path):
+    for i in range(1, len(MIME_EXTENSIONS)):
+        if path.endswith(MIME_EXTENSIONS[i]):
+            return i
+    return 0
+
+
+def used_classes(directory):
+    used = set()
+    for name in MARKUP_SOURCES:
+        with open(os.path.join(directory, name), errors='replace') as f:
+            used.update(W3_CLASS.findall(f.read()))
+    return used
+
+
+def css_blocks(css):
+    """Splits a stylesheet into (prelude, body) pairs, @media bodies stay nested."""
+    blocks = []
+    pos = 0
+    while True:
+        start = css.find('{', pos)
+        if start < 0:
+            return blocks
+        prelude = css[pos:start].strip()
+        depth = 1
+        end = start + 1
+        while depth:
+            if css[end] == '{':
+                depth += 1
+            elif css[end] == '}':
+                depth -= 1
+            end += 1
+        blocks.append((prelude, css[start + 1:end - 1]))
+        pos = end
+
+
+def strip_rules(css, used):
+    """Drops the selectors that need a w3-* class nobody uses, and rules left empty."""
+    out = []
+    for prelude, body in css_blocks(css):
+        if prelude.startswith('@'):
+            inner = strip_rules(body, used)
+            if inner:
+                out.append(prelude + '{' + inner + '}')
+            continue
+        selectors = [sel for sel in prelude.split(',')
+                     if all(c in used for c in W3_CLASS.findall(sel))]
+        if selectors:
+            out.append(','.join(selectors) + '{' + body + '}')
+    return ''.join(out)
+
+
+def strip_keyframes(css):
+    """Drops @keyframes no remaining rule refers to."""
+    blocks = css_blocks(css)
+    rest = ''.join(body for prelude, body in blocks if 'keyframes' not in prelude)
+    out = []
+    for prelude, body in blocks:
+        name = prelude.split()[-1] if 'keyframes' in prelude else None
+        if name is None or re.search(r'\b%s\b' % re.escape(name), rest):
+            out.append(prelude + '{' + body + '}')
+    return ''.join(out)
+
+
+def minify_css(css):
+    return re.sub(r'\s*([{};,])\s*', r'\1', re.sub(r'\s+', ' ', css)).replace(';}', '}').strip()
+
+
+def build_css(data, used):
+    css = data.decode()
+    # keep the license line of w3.css
+    notice = re.match(r'\s*(/\*.*?\*/)', css, re.S)
+    css = re.sub(r'/\*.*?\*/', '', css, flags=re.S)
+    css = minify_css(strip_keyframes(strip_rules(css, used)))
+    if notice:
+        css = notice.group(1) + '\n' + css
+    return css.encode()
+
+
+def build_template(data):
+    html = re.sub(r'<!--.*?-->', '', data.decode(), flags=re.S)
+    html = re.sub(r'>\s+<', '><', html)
+    return re.sub(r'\s+', ' ', html).strip().encode()
+
+
+def collect(directory, gzip_files=True, build=True):
+    """Returns [(node path, content)], plain files before their .gz variant."""
+    used = used_classes(directory) if build else None
+    files = []
+    for name in STATIC_FILES + TEMPLATES:
+        with open(os.path.join(directory, name), 'rb') as f:
+            data = f.read()
+        if build and name.endswith('.css'):
+            data = build_css(data, used)
+        elif build and name.endswith('.tmpl'):
+            data = build_template(data)
+        files.append(('/' + name, data))
+        # templates are rendered on the node, only static files are sent compressed;
+        # mtime=0 keeps the output and with it the ETag stable between builds
+        if gzip_files and name in STATIC_FILES:
+            files.append(('/' + name + '.gz', gzip.compress(data, 9, mtime=0)))
+    return files
+
+
+def write_tar(path, files):
+    with tarfile.open(path, mode='w', format=tarfile.USTAR_FORMAT) as tar:
+        for name, data in files:
+            info = tarfile.TarInfo(name.lstrip('/'))
+            info.size = len(data)
+            tar.addfile(info, io.BytesIO(data))
+
+
+def identifier(path):
+    return 'bundle_' + re.sub('[^0-9a-zA-Z]', '_', path.lstrip('/'))
+
+
+def write_header(out, files):
+    paths = [path for path, _ in files]
+    out.write('// generated by mkbundle.py from the web files, do not edit\n')
+    out.write('// included by lhweb.cpp only\n')
+    out.write('#ifndef LHBUNDLE_H\n#define LHBUNDLE_H\n\n')
+    out.write('#define BUNDLE_COUNT %d\n\n' % len(files))
+
+    for path, data in files:
+        out.write('// %s, %d bytes\n' % (path, len(data)))
+        out.write('static const uint8_t %s[] PROGMEM={\n' % identifier(path))
+        for i in range(0, len(data), 16):
+            out.write('    ' + ','.join('0x%02x' % b for b in data[i:i + 16]) + ',\n')
+        out.write('};\n\n')
+
+    out.write('static const char* bundle_paths[BUNDLE_COUNT]={\n')
+    for path in paths:
+        out.write('    "%s",\n' % path)
+    out.write('};\n\n')
+
+    out.write('static const uint8_t* const bundle_data[BUNDLE_COUNT]={\n')
+    for path in paths:
+        out.write('    %s,\n' % identifier(path))
+    out.write('};\n\n')
+
+    out.write('// path hash, size, CRC32, mime type, flags\n')
+    out.write('static const LHWeb::Asset bundle_assets[BUNDLE_COUNT]={\n')
+    for path, data in files:
+        flags = ASSET_BUNDLE
+        if path + '.gz' in paths:
+            flags |= ASSET_GZIP
+        out.write('    { 0x%08x, %d, 0x%08x, %d, 0x%02x },\n' % (
+            path_hash(path), len(data), zlib.crc32(data), mime_type(path), flags))
+    out.write('};\n\n#endif\n')
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--dir', default=here, help='directory of the web files')
+    parser.add_argument('-o', dest='output', default=os.path.join(here, 'lhbundle.h'))
+    parser.add_argument('--full', action='store_true', help='bundle the files as they are, no stripping or minifying')
+    parser.add_argument('--tar', help='also write the files as a tar archive for /deploy')
+    args = parser.parse_args()
+
+    files = collect(args.dir, build=not args.full)
+    with open(args.output, 'w') as out:
+        write_header(out, files)
+    if args.tar:
+        write_tar(args.tar, files)
+    for path, data in files:
+        print('%-20s %6d bytes' % (path, len(data)))
+
+
+if __name__ == '__main__':
+    main()
@@ -1,12 +1,50 @@
 #!/bin/bash
+#
+# usage: upload.sh [-z] [-t] [ip]
+#   -z  upload gzip compressed variants (<name>.gz) of the static files
+#       as well, they are sent to every browser that accepts gzip
+#   -t  send everything as one tar archive to /deploy instead of one
+#       request per file, the node swaps in the whole set at once
 
-echo -n "IP-Adresse: "
-read ip
+gzip_files=0
+deploy=0
+while getopts "zt" opt; do
+    case $opt in
+        z) gzip_files=1 ;;
+        t) deploy=1 ;;
+        *) echo "usage: $0 [-z] [-t] [ip]"; exit 1 ;;
+    esac
+done
+shift $((OPTIND-1))
 
-curl -i -F "file=@w3.css;filename=/w3.css" "$ip/upload"
-curl -i -F "file=@index.tmpl;filename=/index.tmpl" "$ip/upload"
-curl -i -F "file=@webconfig.tmpl;filename=/webconfig.tmpl" "$ip/upload"
-curl -i -F "file=@browse.tmpl;filename=/browse.tmpl" "$ip/upload"
-curl -i -F "file=@log.tmpl;filename=/log.tmpl" "$ip/upload"
-curl -i -F "file=@userconfig.tmpl;filename=/userconfig.tmpl" "$ip/upload"
+ip=$1
+if [ -z "$ip" ]; then
+    echo -n "IP-Adresse: "
+    read ip
+fi
 
+static_files="w3.css"
+templates="index.tmpl webconfig.tmpl browse.tmpl log.tmpl userconfig.tmpl"
+
+tmp=$(mktemp -d)
+trap 'rm -r "$tmp"' EXIT
+
+files="$static_files $templates"
+cp $files "$tmp"
+
+# templates are rendered on the node, only static files are sent as they are
+if [ $gzip_files -eq 1 ]; then
+    for file in $static_files; do
+        gzip -9 -n -c "$file" > "$tmp/$file.gz"
+        files="$files $file.gz"
+    done
+fi
+
+if [ $deploy -eq 1 ]; then
+    tar -cf "$tmp/bundle.tar" --format=ustar -C "$tmp" $files
+    curl -i -F "file=@$tmp/bundle.tar;filename=bundle.tar" "$ip/deploy"
+else
+    for file in $files; do
+        curl -i -F "file=@$tmp/$file;filename=/$file" "$ip/upload"
+    done
+fi